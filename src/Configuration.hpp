@@ -23,17 +23,46 @@
 #ifndef NUCLEAR_CONFIGURATION_HPP
 #define NUCLEAR_CONFIGURATION_HPP
 
+#include <chrono>
 #include <cstddef>
 #include <thread>
 
+#include "util/ThreadPoolDescriptor.hpp"
+#include "util/ThreadPriorityPolicy.hpp"
+
 namespace NUClear {
 
 /**
  * @brief This class holds the configuration for a PowerPlant.
  */
 struct Configuration {
-    /// @brief The number of threads the system will use
+    /// @brief The number of threads the system will use, or the fewest the default pool will shrink to if it is elastic
     size_t thread_count = std::thread::hardware_concurrency() == 0 ? 2 : std::thread::hardware_concurrency();
+    /// @brief The most threads the default pool will grow to under load, if this is not more than thread_count the
+    /// default pool is a fixed size. Elastic pools are not available when work stealing
+    size_t max_thread_count = 0;
+    /// @brief The default pool grows when this many tasks are queued and none of its threads are idle
+    size_t grow_queue_depth = 4;
+    /// @brief The default pool grows when a task waited this long to start and none of its threads are idle
+    std::chrono::nanoseconds grow_wait_time = std::chrono::milliseconds(1);
+    /// @brief Threads the default pool added are removed again after being idle for this long
+    std::chrono::nanoseconds idle_timeout = std::chrono::seconds(1);
+    /// @brief If the thread pools should give each thread its own task queue and steal work from each other rather
+    /// than having all threads share a single task queue per pool
+    bool work_stealing = false;
+    /// @brief How long an idle thread in the default pool will spin looking for a new task before it goes to sleep.
+    /// Spinning reduces the latency between a task being emitted and it starting, at the cost of cpu time
+    std::chrono::nanoseconds spin_duration = std::chrono::nanoseconds(0);
+    /// @brief The cpus that the threads in the default pool are pinned to, when empty the threads are not pinned
+    util::CPUSet cpu_set{};
+    /// @brief The numa node the default pool's threads allocate memory from (and run on if cpu_set is empty), or -1
+    int numa_node = -1;
+    /// @brief How the default pool chooses which queued task to run next. With earliest deadline first, tasks from
+    /// reactions with a Deadline run in the order their deadlines expire ahead of tasks without one
+    util::SchedulingPolicy scheduling_policy = util::SchedulingPolicy::PRIORITY;
+    /// @brief How task priorities change the operating system priority of the threads that run them. OFF avoids the
+    /// system calls entirely, which is best when the process isn't permitted to use realtime scheduling
+    util::ThreadPriorityPolicy thread_priority_policy = util::ThreadPriorityPolicy::ROUND_ROBIN;
 };
 
 }  // namespace NUClear
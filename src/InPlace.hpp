@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_INPLACE_HPP
+#define NUCLEAR_INPLACE_HPP
+
+#include <memory>
+#include <utility>
+
+#include "util/PoolAllocator.hpp"
+
+namespace NUClear {
+
+/**
+ * @brief A message that has been constructed in a single allocation, ready to be emitted.
+ *
+ * @details
+ *  Emitting a std::unique_ptr has to move the message into a std::shared_ptr, which allocates its control block
+ *  separately from the message. A message made with in_place shares one allocation with its control block. It can
+ *  only be emitted, so like a unique_ptr nothing else has access to the message once it is in the system.
+ *
+ * @tparam T the type of the message
+ */
+template <typename T>
+class InPlace {
+public:
+    explicit InPlace(std::shared_ptr<T>&& data) : data(std::move(data)) {}
+
+    /**
+     * @brief Takes the message out so that it can be emitted
+     *
+     * @return the message
+     */
+    std::shared_ptr<T> release() && {
+        return std::move(data);
+    }
+
+private:
+    /// @brief The message
+    std::shared_ptr<T> data;
+};
+
+/**
+ * @brief Constructs a message in place so that it can be emitted without a second allocation.
+ *
+ * @details
+ *  This can be passed to emit with any scope in place of a std::unique_ptr, and any arguments for the scope follow
+ *  as normal.
+ *  @code emit<Scope::DELAY>(in_place<Message>(a, b), std::chrono::milliseconds(10)); @endcode
+ *  For messages that are emitted at a high rate util::PoolAllocator can be used so that each message reuses the
+ *  memory of the ones before it.
+ *  @code emit(in_place<Message, util::PoolAllocator<Message>>(a, b)); @endcode
+ *
+ * @tparam T         the type of the message
+ * @tparam Allocator the allocator to allocate the message and its control block with
+ * @tparam Arguments the types of the arguments to construct the message with
+ *
+ * @param args the arguments to construct the message with
+ *
+ * @return the constructed message, ready to be emitted
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename... Arguments>
+InPlace<T> in_place(Arguments&&... args) {
+    return InPlace<T>(std::allocate_shared<T>(Allocator(), std::forward<Arguments>(args)...));
+}
+
+}  // namespace NUClear
+
+#endif  // NUCLEAR_INPLACE_HPP
@@ -55,26 +55,64 @@ void PowerPlant::submit(const NUClear::id_t& id,
                         const util::GroupDescriptor& group,
                         const util::ThreadPoolDescriptor& pool,
                         const bool& immediate,
-                        std::function<void()>&& task) {
+                        threading::TaskScheduler::TaskFunction&& task) {
     scheduler.submit(id, priority, group, pool, immediate, std::move(task));
 }
 
 void PowerPlant::submit(std::unique_ptr<threading::ReactionTask>&& task, const bool& immediate) noexcept {
     // Only submit non null tasks
     if (task) {
+        // The task is owned by the function that runs it, it stays where it is so we can still reference it
+        const threading::ReactionTask& t = *task;
+        Reactor& reactor                 = t.parent.reactor;
         try {
-            const std::shared_ptr<threading::ReactionTask> t(std::move(task));
-            submit(t->id, t->priority, t->group_descriptor, t->thread_pool_descriptor, immediate, [t]() { t->run(); });
+            scheduler.submit(threading::TaskScheduler::Task{t.id,
+                                                            t.priority,
+                                                            t.group_descriptor,
+                                                            t.thread_pool_descriptor,
+                                                            [r = std::move(task)]() { r->run(); },
+                                                            t.deadline},
+                             immediate);
         }
         catch (const std::exception& ex) {
-            task->parent.reactor.log<NUClear::ERROR>("There was an exception while submitting a reaction", ex.what());
+            reactor.log<NUClear::ERROR>("There was an exception while submitting a reaction", ex.what());
         }
         catch (...) {
-            task->parent.reactor.log<NUClear::ERROR>("There was an unknown exception while submitting a reaction");
+            reactor.log<NUClear::ERROR>("There was an unknown exception while submitting a reaction");
         }
     }
 }
 
+void PowerPlant::submit(std::vector<std::unique_ptr<threading::ReactionTask>>&& tasks) noexcept {
+    // Reuse this thread's storage for the batch, if another batch is submitted while we log an error it makes its own
+    static thread_local std::vector<threading::TaskScheduler::Task> storage;
+    std::vector<threading::TaskScheduler::Task> batch = std::move(storage);
+    try {
+        batch.reserve(tasks.size());
+        for (auto& task : tasks) {
+            // Only submit non null tasks
+            if (task) {
+                const threading::ReactionTask& t = *task;
+                batch.push_back(threading::TaskScheduler::Task{t.id,
+                                                               t.priority,
+                                                               t.group_descriptor,
+                                                               t.thread_pool_descriptor,
+                                                               [r = std::move(task)]() { r->run(); },
+                                                               t.deadline});
+            }
+        }
+        scheduler.submit(std::move(batch));
+    }
+    catch (const std::exception& ex) {
+        log<NUClear::ERROR>("There was an exception while submitting a batch of reactions", ex.what());
+    }
+    catch (...) {
+        log<NUClear::ERROR>("There was an unknown exception while submitting a batch of reactions");
+    }
+    batch.clear();
+    storage = std::move(batch);
+}
+
 void PowerPlant::shutdown() {
 
     // Stop running before we emit the Shutdown event
@@ -91,4 +129,12 @@ void PowerPlant::shutdown() {
 bool PowerPlant::running() const {
     return is_running.load();
 }
+
+uint64_t PowerPlant::missed_deadlines() const {
+    return scheduler.missed_deadlines();
+}
+
+message::SchedulerStatistics PowerPlant::scheduler_statistics() const {
+    return scheduler.statistics();
+}
 }  // namespace NUClear
@@ -24,6 +24,7 @@
 #define NUCLEAR_POWERPLANT_HPP
 
 #include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -38,9 +39,11 @@
 
 // Utilities
 #include "Configuration.hpp"
+#include "InPlace.hpp"
 #include "LogLevel.hpp"
 #include "id.hpp"
 #include "message/LogMessage.hpp"
+#include "message/SchedulerStatistics.hpp"
 #include "threading/ReactionTask.hpp"
 #include "threading/TaskScheduler.hpp"
 #include "util/FunctionFusion.hpp"
@@ -112,6 +115,22 @@ public:
      */
     bool running() const;
 
+    /**
+     * @brief Gets how many tasks from reactions with a Deadline have started after their deadline.
+     *
+     * @return the number of missed deadlines since the PowerPlant was created
+     */
+    uint64_t missed_deadlines() const;
+
+    /**
+     * @brief Gets a snapshot of how busy the scheduler and each of its thread pools are.
+     *
+     * @details This can also be emitted periodically by emitting a message::SchedulerStatisticsConfiguration
+     *
+     * @return the current state of each thread pool and the totals of its counters
+     */
+    message::SchedulerStatistics scheduler_statistics() const;
+
     /**
      * @brief Installs a reactor of a particular type to the system.
      *
@@ -146,7 +165,7 @@ public:
                 const util::GroupDescriptor& group,
                 const util::ThreadPoolDescriptor& pool,
                 const bool& immediate,
-                std::function<void()>&& task);
+                threading::TaskScheduler::TaskFunction&& task);
 
     /**
      * @brief Submits a new task to the ThreadPool to be queued and then executed.
@@ -156,6 +175,15 @@ public:
      */
     void submit(std::unique_ptr<threading::ReactionTask>&& task, const bool& immediate = false) noexcept;
 
+    /**
+     * @brief Submits a batch of new tasks to the ThreadPool to be queued and then executed.
+     *
+     * @details Each thread pool that the tasks are for is only locked once for the whole batch
+     *
+     * @param tasks The Reaction tasks to be executed in the thread pool, null tasks are ignored
+     */
+    void submit(std::vector<std::unique_ptr<threading::ReactionTask>>&& tasks) noexcept;
+
     /**
      * @brief Log a message through NUClear's system.
      *
@@ -189,6 +217,18 @@ public:
     template <typename T>
     void emit(std::unique_ptr<T>& data);
 
+    /**
+     * @brief Emits a message that was constructed in place with in_place at Local scope.
+     *
+     * @details The message shares a single allocation with its control block.
+     *
+     * @tparam T The type of the data that we are emitting
+     *
+     * @param data The data we are emitting
+     */
+    template <typename T>
+    void emit(InPlace<T>&& data);
+
     /**
      * @brief Emits data to the system and routes it to the other systems that use it.
      *
@@ -234,6 +274,13 @@ public:
               typename... Arguments>
     void emit(std::unique_ptr<T>& data, Arguments&&... args);
 
+    template <template <typename> class First,
+              template <typename>
+              class... Remainder,
+              typename T,
+              typename... Arguments>
+    void emit(InPlace<T>&& data, Arguments&&... args);
+
     template <template <typename> class First, template <typename> class... Remainder, typename... Arguments>
     void emit(Arguments&&... args);
 
@@ -23,11 +23,13 @@
 #include "extension/ChronoController.hpp"
 #include "extension/IOController.hpp"
 #include "extension/NetworkController.hpp"
+#include "extension/ReactionTimingController.hpp"
+#include "extension/SchedulerStatisticsController.hpp"
 
 namespace NUClear {
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
-inline PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[]) : scheduler(config.thread_count) {
+inline PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[]) : scheduler(config) {
 
     // Stop people from making more then one powerplant
     if (powerplant != nullptr) {
@@ -41,6 +43,8 @@ inline PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[]
     install<extension::ChronoController>();
     install<extension::IOController>();
     install<extension::NetworkController>();
+    install<extension::ReactionTimingController>();
+    install<extension::SchedulerStatisticsController>();
 
     // Emit our arguments if any.
     message::CommandLineArguments args;
@@ -78,6 +82,13 @@ void PowerPlant::emit(std::unique_ptr<T>& data) {
     emit<dsl::word::emit::Local>(std::move(data));
 }
 
+// Default emit with no types
+template <typename T>
+void PowerPlant::emit(InPlace<T>&& data) {
+
+    emit<dsl::word::emit::Local>(std::move(data));
+}
+
 // Default emit with no types
 template <template <typename> class First, template <typename> class... Remainder, typename T, typename... Arguments>
 void PowerPlant::emit(std::unique_ptr<T>& data, Arguments&&... args) {
@@ -146,6 +157,13 @@ void PowerPlant::emit(std::unique_ptr<T>&& data, Arguments&&... args) {
     emit_shared<First, Remainder...>(std::shared_ptr<T>(std::move(data)), std::forward<Arguments>(args)...);
 }
 
+template <template <typename> class First, template <typename> class... Remainder, typename T, typename... Arguments>
+void PowerPlant::emit(InPlace<T>&& data, Arguments&&... args) {
+
+    // The message is already in a shared_ptr so it can be emitted as it is
+    emit_shared<First, Remainder...>(std::move(data).release(), std::forward<Arguments>(args)...);
+}
+
 template <template <typename> class First, template <typename> class... Remainder, typename... Arguments>
 void PowerPlant::emit(Arguments&&... args) {
 
@@ -183,7 +201,7 @@ void PowerPlant::log(Arguments&&... args) {
         level,
         current_task != nullptr ? current_task->parent.reactor.log_level : LogLevel::UNKNOWN,
         output_stream.str(),
-        current_task != nullptr ? current_task->stats : nullptr));
+        current_task != nullptr ? current_task->full_statistics() : nullptr));
 }
 
 }  // namespace NUClear
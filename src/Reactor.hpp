@@ -33,7 +33,9 @@
 #include <vector>
 
 #include "Environment.hpp"
+#include "InPlace.hpp"
 #include "LogLevel.hpp"
+#include "StatisticsLevel.hpp"
 #include "dsl/Parse.hpp"
 #include "threading/Reaction.hpp"
 #include "threading/ReactionHandle.hpp"
@@ -54,6 +56,9 @@ namespace dsl {
 
         struct Priority;
 
+        template <int, typename>
+        struct Deadline;
+
         struct IO;
 
         struct UDP;
@@ -66,6 +71,9 @@ namespace dsl {
         template <size_t, typename...>
         struct Last;
 
+        template <typename...>
+        struct Latest;
+
         struct MainThread;
 
         template <typename>
@@ -97,6 +105,9 @@ namespace dsl {
         template <int>
         struct Buffer;
 
+        template <int, typename>
+        struct RateLimit;
+
         template <typename>
         struct Sync;
 
@@ -171,6 +182,25 @@ protected:
     /// @brief The level that this reactor logs at
     LogLevel log_level{LogLevel::INFO};
 
+    /// @brief The level that reactions this reactor creates record statistics at, see set_statistics_level
+    StatisticsLevel statistics_level{StatisticsLevel::FULL};
+
+    /**
+     * @brief Sets how much is recorded in the ReactionStatistics of all of this reactor's reactions.
+     *
+     * @details
+     *  This changes the level of the reactions that have already been created as well as any that are created
+     *  afterwards. Individual reactions can still be changed through their ReactionHandle.
+     *
+     * @param level the statistics level for this reactor's reactions
+     */
+    void set_statistics_level(const StatisticsLevel& level) {
+        statistics_level = level;
+        for (auto& handle : reaction_handles) {
+            handle.statistics(level);
+        }
+    }
+
     /***************************************************************************************************************
      * The types here are imported from other contexts so that when extending from the Reactor type in normal      *
      * usage there does not need to be any namespace declarations on the used types. This affords a simpler API    *
@@ -184,6 +214,10 @@ protected:
     /// @copydoc dsl::word::Priority
     using Priority = dsl::word::Priority;
 
+    /// @copydoc dsl::word::Deadline
+    template <int ticks, class period = std::chrono::milliseconds>
+    using Deadline = dsl::word::Deadline<ticks, period>;
+
     /// @copydoc dsl::word::Always
     using Always = dsl::word::Always;
 
@@ -211,6 +245,10 @@ protected:
     template <size_t len, typename... DSL>
     using Last = dsl::word::Last<len, DSL...>;
 
+    /// @copydoc dsl::word::Latest
+    template <typename... DSL>
+    using Latest = dsl::word::Latest<DSL...>;
+
     /// @copydoc dsl::word::MainThread
     using MainThread = dsl::word::MainThread;
 
@@ -259,6 +297,10 @@ protected:
     template <int N>
     using Buffer = dsl::word::Buffer<N>;
 
+    /// @copydoc dsl::word::RateLimit
+    template <int N, typename period = std::chrono::seconds>
+    using RateLimit = dsl::word::RateLimit<N, period>;
+
     struct Scope {
         /// @copydoc dsl::word::emit::Local
         template <typename T>
@@ -318,6 +360,7 @@ public:
                 reactor,
                 std::move(identifiers),
                 util::CallbackGenerator<DSL, Function>(std::forward<Function>(callback)));
+            reaction->statistics_level = reactor.statistics_level;
 
             // Get our tuple from binding our reaction
             auto tuple = DSL::bind(reaction, std::get<Index>(args)...);
@@ -393,11 +436,21 @@ public:
     void emit(std::unique_ptr<T>& data, Arguments&&... args) {
         powerplant.emit<Handlers...>(std::move(data), std::forward<Arguments>(args)...);
     }
+    template <template <typename> class... Handlers, typename T, typename... Arguments>
+    void emit(InPlace<T>&& data, Arguments&&... args) {
+        powerplant.emit<Handlers...>(std::move(data), std::forward<Arguments>(args)...);
+    }
     template <template <typename> class... Handlers, typename... Arguments>
     void emit(Arguments&&... args) {
         powerplant.emit<Handlers...>(std::forward<Arguments>(args)...);
     }
 
+    /// @copydoc NUClear::in_place
+    template <typename T, typename Allocator = std::allocator<T>, typename... Arguments>
+    static InPlace<T> in_place(Arguments&&... args) {
+        return NUClear::in_place<T, Allocator>(std::forward<Arguments>(args)...);
+    }
+
     /**
      * @brief Log a message through NUClear's system.
      *
@@ -423,16 +476,19 @@ public:
 // Domain Specific Language
 #include "dsl/word/Always.hpp"
 #include "dsl/word/Buffer.hpp"
+#include "dsl/word/Deadline.hpp"
 #include "dsl/word/Every.hpp"
 #include "dsl/word/Group.hpp"
 #include "dsl/word/IO.hpp"
 #include "dsl/word/Last.hpp"
+#include "dsl/word/Latest.hpp"
 #include "dsl/word/MainThread.hpp"
 #include "dsl/word/Network.hpp"
 #include "dsl/word/Once.hpp"
 #include "dsl/word/Optional.hpp"
 #include "dsl/word/Pool.hpp"
 #include "dsl/word/Priority.hpp"
+#include "dsl/word/RateLimit.hpp"
 #include "dsl/word/Shutdown.hpp"
 #include "dsl/word/Single.hpp"
 #include "dsl/word/Startup.hpp"
@@ -0,0 +1,53 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_STATISTICSLEVEL_HPP
+#define NUCLEAR_STATISTICSLEVEL_HPP
+
+#include <cstdint>
+
+namespace NUClear {
+
+/**
+ * @brief How much is recorded about the tasks of a reaction in its ReactionStatistics.
+ *
+ * @details
+ *  Statistics are only ever recorded while something is bound to Trigger<ReactionStatistics>, so when nothing is
+ *  listening tasks do not allocate or read the clock for them regardless of this level.
+ */
+enum class StatisticsLevel : uint8_t {
+    /// @brief Nothing is recorded and no ReactionStatistics are emitted for the reaction's tasks
+    NONE,
+
+    /// @brief The ids, times and exception of each task are recorded along with the reaction's shared identifiers
+    TIMING,
+
+    /// @brief Everything in TIMING, and log messages from the task share its record rather than copying it
+    FULL,
+
+    /// @brief Everything in FULL as well as the cpu time and context switches of the thread while the task ran
+    CPU
+};
+
+}  // namespace NUClear
+
+#endif  // NUCLEAR_STATISTICSLEVEL_HPP
@@ -25,6 +25,8 @@
 
 #include <chrono>
 
+#include "tsc_clock.hpp"
+
 namespace NUClear {
 
 #ifdef NUCLEAR_CLOCK_TYPE
@@ -25,6 +25,7 @@
 
 #include "../threading/ReactionHandle.hpp"
 #include "fusion/BindFusion.hpp"
+#include "fusion/DeadlineFusion.hpp"
 #include "fusion/GetFusion.hpp"
 #include "fusion/GroupFusion.hpp"
 #include "fusion/PoolFusion.hpp"
@@ -42,6 +43,7 @@ namespace dsl {
         , public fusion::GetFusion<Words...>
         , public fusion::PreconditionFusion<Words...>
         , public fusion::PriorityFusion<Words...>
+        , public fusion::DeadlineFusion<Words...>
         , public fusion::GroupFusion<Words...>
         , public fusion::PoolFusion<Words...>
         , public fusion::PostconditionFusion<Words...> {};
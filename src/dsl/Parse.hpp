@@ -57,6 +57,11 @@ namespace dsl {
                 Parse<Sentence...>>(r);
         }
 
+        static inline clock::duration deadline(threading::Reaction& r) {
+            return std::conditional_t<fusion::has_deadline<DSL>::value, DSL, fusion::NoOp>::template deadline<
+                Parse<Sentence...>>(r);
+        }
+
         static inline util::GroupDescriptor group(threading::Reaction& r) {
             return std::conditional_t<fusion::has_group<DSL>::value, DSL, fusion::NoOp>::template group<
                 Parse<Sentence...>>(r);
@@ -0,0 +1,107 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_FUSION_DEADLINEFUSION_HPP
+#define NUCLEAR_DSL_FUSION_DEADLINEFUSION_HPP
+
+#include <algorithm>
+
+#include "../../clock.hpp"
+#include "../../threading/Reaction.hpp"
+#include "../operation/DSLProxy.hpp"
+#include "has_deadline.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace fusion {
+
+        /// Type that redirects types without a deadline function to their proxy type
+        template <typename Word>
+        struct Deadline {
+            using type = std::conditional_t<has_deadline<Word>::value, Word, operation::DSLProxy<Word>>;
+        };
+
+        template <typename, typename = std::tuple<>>
+        struct DeadlineWords;
+
+        /**
+         * @brief Metafunction that extracts all of the Words with a deadline function
+         *
+         * @tparam Word1        The word we are looking at
+         * @tparam WordN        The words we have yet to look at
+         * @tparam FoundWords   The words we have found with deadline functions
+         */
+        template <typename Word1, typename... WordN, typename... FoundWords>
+        struct DeadlineWords<std::tuple<Word1, WordN...>, std::tuple<FoundWords...>>
+            : public std::conditional_t<
+                  has_deadline<typename Deadline<Word1>::type>::value,
+                  /*T*/ DeadlineWords<std::tuple<WordN...>, std::tuple<FoundWords..., typename Deadline<Word1>::type>>,
+                  /*F*/ DeadlineWords<std::tuple<WordN...>, std::tuple<FoundWords...>>> {};
+
+        /**
+         * @brief Termination case for the DeadlineWords metafunction
+         *
+         * @tparam FoundWords The words we have found with deadline functions
+         */
+        template <typename... FoundWords>
+        struct DeadlineWords<std::tuple<>, std::tuple<FoundWords...>> {
+            using type = std::tuple<FoundWords...>;
+        };
+
+
+        // Default case where there are no deadline words
+        template <typename Words>
+        struct DeadlineFuser {};
+
+        // Case where there is only a single word remaining
+        template <typename Word>
+        struct DeadlineFuser<std::tuple<Word>> {
+
+            template <typename DSL>
+            static inline clock::duration deadline(threading::Reaction& reaction) {
+
+                // Return our deadline
+                return Word::template deadline<DSL>(reaction);
+            }
+        };
+
+        // Case where there are 2 or more words remaining
+        template <typename Word1, typename Word2, typename... WordN>
+        struct DeadlineFuser<std::tuple<Word1, Word2, WordN...>> {
+
+            template <typename DSL>
+            static inline clock::duration deadline(threading::Reaction& reaction) {
+
+                // Choose our tightest deadline
+                return std::min(Word1::template deadline<DSL>(reaction),
+                                DeadlineFuser<std::tuple<Word2, WordN...>>::template deadline<DSL>(reaction));
+            }
+        };
+
+        template <typename Word1, typename... WordN>
+        struct DeadlineFusion : public DeadlineFuser<typename DeadlineWords<std::tuple<Word1, WordN...>>::type> {};
+
+    }  // namespace fusion
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_FUSION_DEADLINEFUSION_HPP
@@ -25,6 +25,7 @@
 
 #include <typeindex>
 
+#include "../../clock.hpp"
 #include "../../threading/Reaction.hpp"
 #include "../../threading/ReactionTask.hpp"
 #include "../../util/GroupDescriptor.hpp"
@@ -61,6 +62,11 @@ namespace dsl {
                 return word::Priority::NORMAL::value;
             }
 
+            template <typename DSL>
+            static inline clock::duration deadline(const threading::Reaction& /*reaction*/) {
+                return clock::duration::max();
+            }
+
             template <typename DSL>
             static inline util::GroupDescriptor group(const threading::Reaction& /*reaction*/) {
                 return util::GroupDescriptor{};
@@ -92,6 +98,8 @@ namespace dsl {
 
             static int priority(threading::Reaction&);
 
+            static clock::duration deadline(threading::Reaction&);
+
             static util::GroupDescriptor group(threading::Reaction&);
 
             static util::ThreadPoolDescriptor pool(threading::Reaction&);
@@ -47,21 +47,12 @@ namespace dsl {
 
                 // Our unbinder to remove this reaction
                 reaction->unbinders.push_back([](const threading::Reaction& r) {
-                    auto& vec = store::TypeCallbackStore<DataType>::get();
-
-                    auto it = std::find_if(
-                        std::begin(vec),
-                        std::end(vec),
+                    store::TypeCallbackStore<DataType>::remove(
                         [&r](const std::shared_ptr<threading::Reaction>& item) { return item->id == r.id; });
-
-                    // If the item is in the list erase the item
-                    if (it != std::end(vec)) {
-                        vec.erase(it);
-                    }
                 });
 
                 // Create our reaction and store it in the TypeCallbackStore
-                store::TypeCallbackStore<DataType>::get().push_back(reaction);
+                store::TypeCallbackStore<DataType>::add(reaction);
             }
         };
 
@@ -76,21 +67,18 @@ namespace dsl {
 
                 // Our unbinder to remove this reaction
                 reaction->unbinders.push_back([](const threading::Reaction& r) {
-                    auto& vec = store::TypeCallbackStore<message::ReactionStatistics>::get();
-
-                    auto it = std::find_if(
-                        std::begin(vec),
-                        std::end(vec),
-                        [&r](const std::shared_ptr<threading::Reaction>& item) { return item->id == r.id; });
-
-                    // If the item is in the list erase the item
-                    if (it != std::end(vec)) {
-                        vec.erase(it);
+                    // If the item was in the list it is removed, once nothing is listening tasks stop recording
+                    if (store::TypeCallbackStore<message::ReactionStatistics>::remove(
+                            [&r](const std::shared_ptr<threading::Reaction>& item) { return item->id == r.id; })) {
+                        --threading::Reaction::statistics_subscribers;
                     }
                 });
 
                 // Create our reaction and store it in the TypeCallbackStore
-                store::TypeCallbackStore<message::ReactionStatistics>::get().push_back(reaction);
+                store::TypeCallbackStore<message::ReactionStatistics>::add(reaction);
+
+                // Now that something is listening, tasks start recording their statistics
+                ++threading::Reaction::statistics_subscribers;
             }
         };
 
@@ -40,6 +40,8 @@ namespace dsl {
          *          differnt type of message user in its own location the system knows exactly which reactions to
          *          execuing without having to do an expensive lookup. This reduces the latency and computational
          *          power invovled in spawning a new reaction when a type is emitted.
+         *          The list is copy on write so reactions can be bound and unbound while other threads are emitting,
+         *          and emitting only needs a single atomic load to check it has the latest version of the list.
          *
          * @tparam TriggeringType the type that when emitted will start this function
          */
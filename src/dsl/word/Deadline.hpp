@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_DEADLINE_HPP
+#define NUCLEAR_DSL_WORD_DEADLINE_HPP
+
+#include <chrono>
+
+#include "../../clock.hpp"
+#include "../../threading/Reaction.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  Gives the tasks from this reaction a deadline to start by, relative to when they are created.
+         *
+         * @details
+         *  @code on<Trigger<T, ...>, Deadline<2, std::chrono::milliseconds>>() @endcode
+         *  In a thread pool using the EARLIEST_DEADLINE_FIRST scheduling policy, tasks are run in the order their
+         *  deadlines expire rather than by priority. Tasks from reactions without a deadline run once there are no
+         *  tasks with a deadline waiting, in priority order.
+         *
+         *  In any thread pool, a task that starts after its deadline is counted as a missed deadline by the PowerPlant.
+         *  The deadline of each task is also available from its ReactionStatistics.
+         *
+         * @par Default Behaviour
+         *  @code on<Trigger<T>>() @endcode
+         *  When the deadline is not specified, tasks do not have a deadline.
+         *
+         * @par Implements
+         *  Fusion
+         *
+         * @tparam ticks
+         *  the number of ticks of a particular type the task has to start
+         * @tparam period
+         *  a type of duration (e.g. std::chrono::seconds) to measure the ticks in, this will default to milliseconds
+         */
+        template <int ticks, class period = std::chrono::milliseconds>
+        struct Deadline {
+
+            template <typename DSL>
+            static inline clock::duration deadline(const threading::Reaction& /*reaction*/) {
+                return std::chrono::duration_cast<clock::duration>(period(ticks));
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_DEADLINE_HPP
@@ -23,8 +23,15 @@
 #ifndef NUCLEAR_DSL_WORD_LAST_HPP
 #define NUCLEAR_DSL_WORD_LAST_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
 #include <list>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 #include "../../threading/Reaction.hpp"
 #include "../../util/MergeTransient.hpp"
@@ -34,33 +41,142 @@ namespace dsl {
     namespace word {
 
         /**
-         * @brief A class that stores the last received items from a reaction
+         * @brief A read only view of the last items that were received by a reaction, from oldest to newest
          *
-         * This class stores the received items and provides conversion operators so that when passed into the reaction
-         * it can be converted to an appropriate type.
+         * @details
+         *  The reaction writes its items into a ring made of blocks of n items, and a view is where its oldest item is
+         *  and how many items it has along with the one or two blocks they are in. Giving a task its items is only a
+         *  reference count on those blocks rather than a copy. A block is only written to again once no task holds
+         *  it, so the items a task sees never change underneath it. When tasks are backed up holding the older blocks
+         *  the reaction starts a new block rather than copying the items.
          *
-         * @tparam n The number of items to store.
-         * @tparam T The type of the items to store.
+         * @tparam T The type of the items that are stored.
          */
-        template <size_t n, typename T>
-        struct LastItemStorage {
-            LastItemStorage() = default;
+        template <typename T>
+        class LastItems {
+        public:
+            /// @brief A random access iterator over the items from oldest to newest
+            class const_iterator {
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type        = T;
+                using difference_type   = std::ptrdiff_t;
+                using pointer           = const T*;
+                using reference         = const T&;
+
+                const_iterator(const LastItems* items, const size_t& index) : items(items), index(index) {}
+
+                reference operator*() const {
+                    return (*items)[index];
+                }
+                pointer operator->() const {
+                    return &(*items)[index];
+                }
+                reference operator[](const difference_type& i) const {
+                    return (*items)[index + i];
+                }
+                const_iterator& operator++() {
+                    ++index;
+                    return *this;
+                }
+                const_iterator operator++(int) {
+                    const_iterator it = *this;
+                    ++index;
+                    return it;
+                }
+                const_iterator& operator--() {
+                    --index;
+                    return *this;
+                }
+                const_iterator operator--(int) {
+                    const_iterator it = *this;
+                    --index;
+                    return it;
+                }
+                const_iterator& operator+=(const difference_type& i) {
+                    index += i;
+                    return *this;
+                }
+                const_iterator& operator-=(const difference_type& i) {
+                    index -= i;
+                    return *this;
+                }
+                const_iterator operator+(const difference_type& i) const {
+                    return const_iterator(items, index + i);
+                }
+                const_iterator operator-(const difference_type& i) const {
+                    return const_iterator(items, index - i);
+                }
+                difference_type operator-(const const_iterator& other) const {
+                    return difference_type(index) - difference_type(other.index);
+                }
+                bool operator==(const const_iterator& other) const {
+                    return index == other.index;
+                }
+                bool operator!=(const const_iterator& other) const {
+                    return index != other.index;
+                }
+                bool operator<(const const_iterator& other) const {
+                    return index < other.index;
+                }
+                bool operator>(const const_iterator& other) const {
+                    return index > other.index;
+                }
+                bool operator<=(const const_iterator& other) const {
+                    return index <= other.index;
+                }
+                bool operator>=(const const_iterator& other) const {
+                    return index >= other.index;
+                }
+
+            private:
+                const LastItems* items;
+                size_t index;
+            };
+
+            /// @brief The number of items
+            size_t size() const {
+                return count;
+            }
+
+            /// @brief If there are no items
+            bool empty() const {
+                return count == 0;
+            }
 
             /**
-             * @brief Constructs a LastItemStorage object with the given data.
+             * @brief Gets an item by how old it is
              *
-             * @param data The data to store.
-             */
-            explicit LastItemStorage(T&& data) : list({std::move(data)}) {}
-            /**
-             * @brief Constructs a LastItemStorage object with the given data.
+             * @param i the index of the item, where 0 is the oldest item
              *
-             * @param data The data to store.
+             * @return the item
              */
-            explicit LastItemStorage(const T& data) : list({data}) {}
+            const T& operator[](const size_t& i) const {
+                const size_t index = head + i;
+                const size_t first = blocks[0]->size();
+                return index < first ? (*blocks[0])[index] : (*blocks[1])[index - first];
+            }
+
+            /// @brief The oldest item
+            const T& front() const {
+                return (*this)[0];
+            }
+
+            /// @brief The newest item
+            const T& back() const {
+                return (*this)[count - 1];
+            }
+
+            const_iterator begin() const {
+                return const_iterator(this, 0);
+            }
+
+            const_iterator end() const {
+                return const_iterator(this, count);
+            }
 
             /**
-             * @brief Converts the stored list to a list of the given type.
+             * @brief Converts the stored items to a list of the given type.
              *
              * @tparam Output The type of the output list.
              *
@@ -68,18 +184,11 @@ namespace dsl {
              */
             template <typename Output>
             operator std::list<Output>() const {
-
-                std::list<Output> out;
-
-                for (const T& item : list) {
-                    out.push_back(Output(item));
-                }
-
-                return out;
+                return std::list<Output>(begin(), end());
             }
 
             /**
-             * @brief Converts the stored list to a vector of the given type.
+             * @brief Converts the stored items to a vector of the given type.
              *
              * @tparam Output The type of the output vector.
              *
@@ -87,28 +196,110 @@ namespace dsl {
              */
             template <typename Output>
             operator std::vector<Output>() const {
-
-                std::vector<Output> out;
-
-                for (const T& item : list) {
-                    out.push_back(Output(item));
-                }
-
-                return out;
+                return std::vector<Output>(begin(), end());
             }
 
             /**
              * @brief Bool operator to allow the reaction to decide not to run if there is no data.
              *
-             * @return true     If the list is not empty.
-             * @return false    If the list is empty.
+             * @return true     If there are items.
+             * @return false    If there are no items.
              */
             operator bool() const {
-                return !list.empty();
+                return !empty();
+            }
+
+        protected:
+            /// @brief The block holding the oldest item, and the block after it if the items continue into it
+            std::array<std::shared_ptr<const std::vector<T>>, 2> blocks{};
+            /// @brief The index in the first block of the oldest item
+            size_t head{0};
+            /// @brief The number of items that belong to this view
+            size_t count{0};
+        };
+
+        /**
+         * @brief A class that stores the last received items from a reaction
+         *
+         * @details
+         *  This is made holding only the newest item, which is then added to the reaction's ring when it is merged
+         *  with the reaction's stored items. After that it is a view of all the stored items.
+         *
+         * @tparam n The number of items to store.
+         * @tparam T The type of the items to store.
+         */
+        template <size_t n, typename T>
+        struct LastItemStorage : public LastItems<T> {
+            LastItemStorage() = default;
+
+            /**
+             * @brief Constructs a LastItemStorage object with the given data.
+             *
+             * @param data The data to store.
+             */
+            explicit LastItemStorage(T&& data) : incoming(std::move(data)), has_incoming(true) {}
+            /**
+             * @brief Constructs a LastItemStorage object with the given data.
+             *
+             * @param data The data to store.
+             */
+            explicit LastItemStorage(const T& data) : incoming(data), has_incoming(true) {}
+
+            /**
+             * @brief Adds the incoming item from another storage as the newest item, and makes that storage a view of
+             *        the items in this one.
+             *
+             * @param d the storage holding the newest item
+             */
+            void merge(LastItemStorage& d) {
+
+                if (d.has_incoming) {
+                    // Start a new block once the current one is full. The block before it can be written over if no
+                    // task is still looking at it, otherwise it is left to those tasks and a new block is made
+                    if (current == nullptr || fill == n) {
+                        std::shared_ptr<std::vector<T>> next = std::move(previous);
+                        if (next != nullptr && next.use_count() == 1) {
+                            // The last task that had this block is finished with it, make sure we see everything it did
+                            std::atomic_thread_fence(std::memory_order_acquire);
+                        }
+                        else {
+                            next = std::make_shared<std::vector<T>>(n);
+                        }
+                        previous = std::move(current);
+                        current  = std::move(next);
+                        fill     = 0;
+                    }
+
+                    (*current)[fill++] = std::move(d.incoming);
+                    stored             = std::min(stored + 1, n);
+                    d.has_incoming     = false;
+                }
+
+                // The storage now views the newest items, only holding the previous block if some of them are in it
+                if (stored <= fill) {
+                    d.blocks = {{current, nullptr}};
+                    d.head   = fill - stored;
+                }
+                else {
+                    d.blocks = {{previous, current}};
+                    d.head   = n - (stored - fill);
+                }
+                d.count = stored;
             }
 
-            /// The items we are storing
-            std::list<T> list;
+        private:
+            /// The newest item, before it has been merged into the stored items
+            T incoming{};
+            /// If there is a newest item to be merged
+            bool has_incoming{false};
+            /// The block before the one being written to, only used by the storage that is kept with the reaction
+            std::shared_ptr<std::vector<T>> previous;
+            /// The block new items are written to, only used by the storage that is kept with the reaction
+            std::shared_ptr<std::vector<T>> current;
+            /// The number of items that have been written to the current block
+            size_t fill{0};
+            /// The number of items the reaction has stored, which is at most n
+            size_t stored{0};
         };
 
         /**
@@ -122,6 +313,7 @@ namespace dsl {
          *  the subscribing reaction. This list is ordered such that the oldest element is first, and the newest
          *  element is last.  Once n messages are stored, the trigger of a new reaction task will cause the
          *  newest copy to be appended to the list, and the oldest copy to be dropped.
+         *  The items can be taken as a std::list or std::vector, or as a LastItems view which doesn't copy them.
          *
          *  This word is a modifier, and should be used to modify any "Get" DSL word.
          *
@@ -193,19 +385,7 @@ namespace util {
     template <size_t n, typename T>
     struct MergeTransients<dsl::word::LastItemStorage<n, T>> {
         static inline bool merge(dsl::word::LastItemStorage<n, T>& t, dsl::word::LastItemStorage<n, T>& d) {
-
-            // We put the contents from data into the transient storage list
-            t.list.insert(t.list.end(), d.list.begin(), d.list.end());
-
-            // Then truncate the old transient data
-            if (t.list.size() > n) {
-                t.list.erase(t.list.begin(), std::next(t.list.begin(), t.list.size() - n));
-            }
-
-            // Finally clear the data list and put the transient list in it
-            d.list.clear();
-            d.list.insert(d.list.begin(), t.list.begin(), t.list.end());
-
+            t.merge(d);
             return true;
         };
     };
@@ -0,0 +1,224 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_LATEST_HPP
+#define NUCLEAR_DSL_WORD_LATEST_HPP
+
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../threading/Reaction.hpp"
+#include "../../util/MergeTransient.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief Holds the data for a reaction that only runs on the newest data
+         *
+         * @details
+         *  The reaction keeps one of these which holds the newest data and whether a task is waiting to use it. Each
+         *  task gets one which, when the task starts, takes the newest data from the reaction's one. If the task never
+         *  uses its data, the reaction is told the task is done when the task is destroyed and the data is left for
+         *  the next task. The reaction's slot is made when its storage is made as the reaction is bound, so tasks
+         *  merging their data from several threads all find the same slot.
+         *
+         * @tparam T The type of the data.
+         */
+        template <typename T>
+        class LatestItem {
+        private:
+            /// @brief The newest data for the reaction and if there is a task waiting to run with it
+            struct Slot {
+                std::mutex mutex;
+                T data{};
+                bool pending{false};
+            };
+
+            /// @brief The task's claim on the data in the slot, which is shared by all copies of the task's data
+            struct Ticket {
+                explicit Ticket(std::shared_ptr<Slot> slot) : slot(std::move(slot)) {}
+                Ticket(const Ticket& /*other*/)            = delete;
+                Ticket(Ticket&& /*other*/)                 = delete;
+                Ticket& operator=(const Ticket& /*other*/) = delete;
+                Ticket& operator=(Ticket&& /*other*/)      = delete;
+
+                ~Ticket() {
+                    // The task finished without using its data, so the next data will need a new task. The data is only
+                    // taken by a claim, so it is left in the slot rather than being thrown away here
+                    if (!claimed) {
+                        const std::lock_guard<std::mutex> lock(slot->mutex);
+                        slot->pending = false;
+                    }
+                }
+
+                /// @brief Takes the newest data the first time it is called, after which new data needs a new task
+                const T& claim() {
+                    if (!claimed) {
+                        const std::lock_guard<std::mutex> lock(slot->mutex);
+                        data          = std::move(slot->data);
+                        slot->data    = T();
+                        slot->pending = false;
+                        claimed       = true;
+                    }
+                    return data;
+                }
+
+                std::shared_ptr<Slot> slot;
+                T data{};
+                bool claimed{false};
+            };
+
+        public:
+            /// @brief Makes the reaction's storage, which owns the slot that every task's data is merged into
+            LatestItem() : slot(std::make_shared<Slot>()) {}
+
+            /**
+             * @brief Constructs a LatestItem object with the data that triggered the task.
+             *
+             * @param data The data to store.
+             */
+            explicit LatestItem(T&& data) : incoming(std::move(data)) {}
+            /**
+             * @brief Constructs a LatestItem object with the data that triggered the task.
+             *
+             * @param data The data to store.
+             */
+            explicit LatestItem(const T& data) : incoming(data) {}
+
+            /**
+             * @brief Stores the data from a new task as the newest data.
+             *
+             * @details If there is already a task waiting it will use this data, and the new task is cancelled.
+             *
+             * @param d the new task's item
+             */
+            void merge(LatestItem& d) {
+                const std::lock_guard<std::mutex> lock(slot->mutex);
+                slot->data = std::move(d.incoming);
+                if (slot->pending) {
+                    d.ticket = nullptr;
+                }
+                else {
+                    slot->pending = true;
+                    d.ticket      = std::make_shared<Ticket>(slot);
+                }
+            }
+
+            /// @brief The newest data, taken when it is first used by the task
+            operator const T&() const {
+                return ticket->claim();
+            }
+
+            /// @brief Dereferences the newest data, taken when it is first used by the task
+            template <typename U = T>
+            auto operator*() const -> decltype(*std::declval<const U&>()) {
+                return *ticket->claim();
+            }
+
+            /**
+             * @brief Bool operator to cancel the task if there was already a task waiting for the data.
+             *
+             * @return true     If this task should run.
+             * @return false    If another task will run with this data.
+             */
+            operator bool() const {
+                return ticket != nullptr;
+            }
+
+        private:
+            /// The data that triggered this task, before it is merged into the reaction's slot
+            T incoming{};
+            /// The reaction's slot, only used by the item that is stored with the reaction
+            std::shared_ptr<Slot> slot;
+            /// The task's claim on the slot, only used by the items given to tasks
+            std::shared_ptr<Ticket> ticket;
+        };
+
+        /**
+         * @brief
+         *  This is used to make a reaction only run on the newest data, replacing the data of a waiting task rather
+         *  than making a new task.
+         *
+         * @details
+         *  @code on<Latest<Trigger<T>>>() @endcode
+         *  When the subscribing reaction is triggered and there is no task for this reaction waiting to start, a new
+         *  task is created and scheduled as normal. However, if there is a task waiting to start then no new task is
+         *  created, and instead the waiting task will run with the newer data. Once a task has started, the next
+         *  trigger will create a new task.
+         *
+         *  Unlike Single or Buffer which drop the new data, this means the queue stays short while the reaction
+         *  always runs on the freshest data.
+         *
+         *  The data is taken by the task when the reaction first uses it. If the reaction doesn't use the data then
+         *  data that arrives while the task is running is dropped.
+         *
+         * @par Implements
+         *  Modification
+         *
+         * @tparam DSLWords
+         *  the DSL word being modified, this must be a word that gets a single piece of data such as Trigger
+         */
+        template <typename... DSLWords>
+        struct Latest : public Fusion<DSLWords...> {
+
+            template <typename DSL>
+            static inline auto get(threading::Reaction& reaction) -> std::tuple<
+                LatestItem<std::tuple_element_t<0, decltype(Fusion<DSLWords...>::template get<DSL>(reaction))>>> {
+
+                using Data = decltype(Fusion<DSLWords...>::template get<DSL>(reaction));
+                static_assert(std::tuple_size<Data>::value == 1, "Latest can only be used with a single piece of data");
+
+                // Wrap our data so it can be replaced by newer data
+                return std::make_tuple(LatestItem<std::tuple_element_t<0, Data>>(
+                    std::move(std::get<0>(Fusion<DSLWords...>::template get<DSL>(reaction)))));
+            }
+        };
+
+    }  // namespace word
+
+    namespace trait {
+
+        template <typename T>
+        struct is_transient<word::LatestItem<T>> : public std::true_type {};
+
+    }  // namespace trait
+}  // namespace dsl
+
+namespace util {
+
+    template <typename T>
+    struct MergeTransients<dsl::word::LatestItem<T>> {
+        static inline bool merge(dsl::word::LatestItem<T>& t, dsl::word::LatestItem<T>& d) {
+            t.merge(d);
+            return true;
+        };
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_LATEST_HPP
@@ -23,6 +23,8 @@
 #ifndef NUCLEAR_DSL_WORD_POOL_HPP
 #define NUCLEAR_DSL_WORD_POOL_HPP
 
+#include <chrono>
+#include <cstdint>
 #include <map>
 #include <mutex>
 #include <typeindex>
@@ -64,12 +66,162 @@ namespace dsl {
          *      static constexpr int thread_count = 2;
          *  };
          *  @endcode
+         *  It may also contain a static int member that sets how many microseconds an idle thread in this pool will
+         *  spin looking for a new task before it goes to sleep. When this is not given idle threads sleep immediately.
+         *  @code
+         *      static constexpr int spin_microseconds = 50;
+         *  @endcode
+         *  The threads can be pinned to a set of cpus with a mask of the first 64 cpus, and can allocate their memory
+         *  from a numa node. If a numa node is given without a cpu mask the threads are pinned to that node's cpus.
+         *  @code
+         *      static constexpr uint64_t cpu_mask = 0b1100;
+         *      static constexpr int numa_node = 0;
+         *  @endcode
+         *  The threads can run tasks in the order their deadlines expire rather than by priority. Tasks from reactions
+         *  that don't have a Deadline run after those that do, in priority order.
+         *  @code
+         *      static constexpr auto scheduling_policy = NUClear::util::SchedulingPolicy::EARLIEST_DEADLINE_FIRST;
+         *  @endcode
+         *  The pool can be made elastic by giving the most threads it can grow to. It will add threads when tasks are
+         *  backing up and remove them again when they are idle, never going below thread_count.
+         *  @code
+         *      static constexpr int max_thread_count = 8;
+         *  @endcode
+         *  An elastic pool grows when this many tasks are queued, or when a task waited this many microseconds to
+         *  start, while none of its threads are idle. Threads it added leave again after being idle for this many
+         *  milliseconds. When these are not given the pool grows at 4 tasks or 1000 microseconds and shrinks after
+         *  1000 milliseconds.
+         *  @code
+         *      static constexpr int grow_queue_depth = 2;
+         *      static constexpr int grow_wait_microseconds = 500;
+         *      static constexpr int idle_timeout_milliseconds = 100;
+         *  @endcode
          */
+        namespace pool {
+            /// @brief Gets the spin duration for a PoolType, which is zero when PoolType doesn't specify one
+            template <typename PoolType, typename = void>
+            struct SpinDuration {
+                static constexpr std::chrono::nanoseconds value() {
+                    return std::chrono::nanoseconds(0);
+                }
+            };
+            template <typename PoolType>
+            struct SpinDuration<PoolType, decltype(void(PoolType::spin_microseconds))> {
+                static constexpr std::chrono::nanoseconds value() {
+                    return std::chrono::microseconds(
+                        static_cast<std::chrono::microseconds::rep>(PoolType::spin_microseconds));
+                }
+            };
+
+            /// @brief Gets the cpus for a PoolType, which is empty when PoolType doesn't specify a cpu mask
+            template <typename PoolType, typename = void>
+            struct CPUSet {
+                static util::CPUSet value() {
+                    return util::CPUSet{};
+                }
+            };
+            template <typename PoolType>
+            struct CPUSet<PoolType, decltype(void(PoolType::cpu_mask))> {
+                static util::CPUSet value() {
+                    return util::CPUSet(static_cast<uint64_t>(PoolType::cpu_mask));
+                }
+            };
+
+            /// @brief Gets the numa node for a PoolType, which is -1 when PoolType doesn't specify one
+            template <typename PoolType, typename = void>
+            struct NumaNode {
+                static constexpr int value() {
+                    return -1;
+                }
+            };
+            template <typename PoolType>
+            struct NumaNode<PoolType, decltype(void(PoolType::numa_node))> {
+                static constexpr int value() {
+                    return static_cast<int>(PoolType::numa_node);
+                }
+            };
+
+            /// @brief Gets the scheduling policy for a PoolType, which is PRIORITY when PoolType doesn't specify one
+            template <typename PoolType, typename = void>
+            struct Policy {
+                static constexpr util::SchedulingPolicy value() {
+                    return util::SchedulingPolicy::PRIORITY;
+                }
+            };
+            template <typename PoolType>
+            struct Policy<PoolType, decltype(void(PoolType::scheduling_policy))> {
+                static constexpr util::SchedulingPolicy value() {
+                    return static_cast<util::SchedulingPolicy>(PoolType::scheduling_policy);
+                }
+            };
+
+            /// @brief Gets the most threads for a PoolType, which is 0 (not elastic) when PoolType doesn't specify it
+            template <typename PoolType, typename = void>
+            struct MaxThreadCount {
+                static constexpr size_t value() {
+                    return 0;
+                }
+            };
+            template <typename PoolType>
+            struct MaxThreadCount<PoolType, decltype(void(PoolType::max_thread_count))> {
+                static constexpr size_t value() {
+                    return static_cast<size_t>(PoolType::max_thread_count);
+                }
+            };
+
+            /// @brief Gets the queue depth an elastic PoolType grows at, which is 4 when PoolType doesn't specify it
+            template <typename PoolType, typename = void>
+            struct GrowQueueDepth {
+                static constexpr size_t value() {
+                    return 4;
+                }
+            };
+            template <typename PoolType>
+            struct GrowQueueDepth<PoolType, decltype(void(PoolType::grow_queue_depth))> {
+                static constexpr size_t value() {
+                    return static_cast<size_t>(PoolType::grow_queue_depth);
+                }
+            };
+
+            /// @brief Gets how long a task waits before an elastic PoolType grows, which is 1ms when not specified
+            template <typename PoolType, typename = void>
+            struct GrowWait {
+                static constexpr std::chrono::nanoseconds value() {
+                    return std::chrono::milliseconds(1);
+                }
+            };
+            template <typename PoolType>
+            struct GrowWait<PoolType, decltype(void(PoolType::grow_wait_microseconds))> {
+                static constexpr std::chrono::nanoseconds value() {
+                    return std::chrono::microseconds(
+                        static_cast<std::chrono::microseconds::rep>(PoolType::grow_wait_microseconds));
+                }
+            };
+
+            /// @brief Gets how long an added thread of an elastic PoolType idles before leaving, which is 1s when not
+            /// specified
+            template <typename PoolType, typename = void>
+            struct IdleTimeout {
+                static constexpr std::chrono::nanoseconds value() {
+                    return std::chrono::seconds(1);
+                }
+            };
+            template <typename PoolType>
+            struct IdleTimeout<PoolType, decltype(void(PoolType::idle_timeout_milliseconds))> {
+                static constexpr std::chrono::nanoseconds value() {
+                    return std::chrono::milliseconds(
+                        static_cast<std::chrono::milliseconds::rep>(PoolType::idle_timeout_milliseconds));
+                }
+            };
+        }  // namespace pool
+
         template <typename PoolType>
         struct Pool {
 
             static_assert(PoolType::thread_count > 0, "Can not have a thread pool with less than 1 thread");
 
+            /// @brief the settings for the thread pool, which are only read when the pool is created
+            static const util::ThreadPoolOptions pool_options;
             /// @brief the description of the thread pool to be used for this PoolType
             static const util::ThreadPoolDescriptor pool_descriptor;
 
@@ -84,11 +236,23 @@ namespace dsl {
             }
         };
 
+        // Initialise the thread pool options
+        template <typename PoolType>
+        const util::ThreadPoolOptions Pool<PoolType>::pool_options = {pool::SpinDuration<PoolType>::value(),
+                                                                      pool::CPUSet<PoolType>::value(),
+                                                                      pool::NumaNode<PoolType>::value(),
+                                                                      pool::Policy<PoolType>::value(),
+                                                                      pool::MaxThreadCount<PoolType>::value(),
+                                                                      pool::GrowQueueDepth<PoolType>::value(),
+                                                                      pool::GrowWait<PoolType>::value(),
+                                                                      pool::IdleTimeout<PoolType>::value()};
+
         // Initialise the thread pool descriptor
         template <typename PoolType>
         const util::ThreadPoolDescriptor Pool<PoolType>::pool_descriptor = {
             util::ThreadPoolDescriptor::get_unique_pool_id(),
-            PoolType::thread_count};
+            PoolType::thread_count,
+            &Pool<PoolType>::pool_options};
 
     }  // namespace word
 }  // namespace dsl
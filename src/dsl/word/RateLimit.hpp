@@ -0,0 +1,105 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_RATELIMIT_HPP
+#define NUCLEAR_DSL_WORD_RATELIMIT_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#include "../../clock.hpp"
+#include "../../threading/Reaction.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to specify that the associated reaction can run at most n times in each period.
+         *
+         * @details
+         *  @code on<Trigger<T, ...>, RateLimit<n, period>>() @endcode
+         *  Each reaction has a token bucket which holds up to <i>n</i> tokens and refills at <i>n</i> tokens per
+         *  period. When the subscribing reaction is triggered and there is a token in the bucket, a token is taken and
+         *  a new task is created and scheduled as normal. However, if the bucket is empty then this new task request
+         *  will be ignored, before any task is created.
+         *
+         *  The bucket is a single atomic time point for each reaction (the generic cell rate algorithm) so checking it
+         *  never takes a lock.
+         *
+         * @attention
+         *  The token is taken as soon as RateLimit's precondition passes and is never given back. If a word that is
+         *  checked later drops the task, such as a Single precondition after RateLimit or a Trigger or With whose data
+         *  is not available yet, the token is still spent and no task runs for it. Preconditions are checked in order,
+         *  so put other words that might stop the task, such as Single, before RateLimit.
+         *
+         * @par Implements
+         *  Precondition
+         *
+         * @tparam n
+         *  the number of tasks that can be created in each period, and the number that can be created in a burst
+         * @tparam period
+         *  the length of time that n tasks can be created in (e.g. std::chrono::seconds)
+         */
+        template <int n, typename period = std::chrono::seconds>
+        struct RateLimit {
+            static_assert(n > 0, "RateLimit must allow at least one task each period");
+
+            /// @brief The length of the period in nanoseconds
+            static constexpr int64_t length = std::chrono::duration_cast<std::chrono::nanoseconds>(period(1)).count();
+            /// @brief The time it takes for one token to be added to the bucket
+            static constexpr int64_t interval = length / n;
+            /// @brief How far ahead of now the bucket can be full before it is empty
+            static constexpr int64_t burst = interval * (n - 1);
+
+            static_assert(interval > 0, "RateLimit can not allow more than one task each nanosecond");
+
+            template <typename DSL>
+            static inline bool precondition(threading::Reaction& reaction) {
+
+                const int64_t now =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(NUClear::clock::now().time_since_epoch())
+                        .count();
+
+                // Take a token by moving when the bucket will be full again forward one interval, unless it is empty
+                int64_t full = reaction.rate_limit_time.load(std::memory_order_relaxed);
+                int64_t next = 0;
+                do {
+                    const int64_t start = std::max(full, now);
+                    if (start - now > burst) {
+                        return false;
+                    }
+                    next = start + interval;
+                } while (
+                    !reaction.rate_limit_time.compare_exchange_weak(full, next, std::memory_order_relaxed));
+
+                return true;
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_RATELIMIT_HPP
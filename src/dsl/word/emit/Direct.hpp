@@ -58,8 +58,11 @@ namespace dsl {
 
                 static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
 
+                    // The reactions run on this thread and may change the list, so we hold on to this version of it
+                    const auto reactions = store::TypeCallbackStore<DataType>::get();
+
                     // Run all our reactions that are interested
-                    for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
+                    for (const auto& reaction : *reactions) {
                         // Set our thread local store data each time (as during direct it can be overwritten)
                         store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
                         powerplant.submit(reaction->get_task(), true);
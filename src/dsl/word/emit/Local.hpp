@@ -34,6 +34,19 @@ namespace dsl {
     namespace word {
         namespace emit {
 
+            /**
+             * @brief Gets the vector this thread uses to build a batch of tasks, so that emitting doesn't allocate
+             *
+             * @details
+             *  An emit takes the vector out while it builds its batch and puts it back once the batch is submitted. An
+             *  emit that happens in the middle of that, for example from logging an error, finds it empty and uses a
+             *  vector of its own.
+             */
+            inline std::vector<std::unique_ptr<threading::ReactionTask>>& local_task_batch() {
+                static thread_local std::vector<std::unique_ptr<threading::ReactionTask>> batch;
+                return batch;
+            }
+
             /**
              * @brief
              *  When emitting data under this scope, tasks are distributed via the thread pool for execution.
@@ -55,12 +68,28 @@ namespace dsl {
 
                 static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
 
-                    // Run all our reactions that are interested
-                    for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
+                    // Creating tasks doesn't run any reactions so this thread's version of the list can't change
+                    const auto& reactions = *store::TypeCallbackStore<DataType>::get();
+
+                    // Set our thread local store data
+                    store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
+
+                    // A single reaction can be submitted on its own without building a batch
+                    if (reactions.size() == 1) {
+                        powerplant.submit(reactions.front()->get_task());
+                    }
+                    // Otherwise make all the tasks first so the thread pools only need to be locked once
+                    else if (!reactions.empty()) {
+                        std::vector<std::unique_ptr<threading::ReactionTask>> tasks = std::move(local_task_batch());
+                        tasks.reserve(reactions.size());
+                        for (auto& reaction : reactions) {
+                            tasks.push_back(reaction->get_task());
+                        }
+                        powerplant.submit(std::move(tasks));
 
-                        // Set our thread local store data
-                        store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
-                        powerplant.submit(reaction->get_task());
+                        // Keep the storage for the next batch
+                        tasks.clear();
+                        local_task_batch() = std::move(tasks);
                     }
 
                     // Unset our thread local store data
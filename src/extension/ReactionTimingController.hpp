@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_REACTIONTIMINGCONTROLLER_HPP
+#define NUCLEAR_EXTENSION_REACTIONTIMINGCONTROLLER_HPP
+
+#include <map>
+
+#include "../PowerPlant.hpp"
+#include "../Reactor.hpp"
+#include "../message/ReactionTimingConfiguration.hpp"
+#include "../message/ReactionTimingSummary.hpp"
+#include "../threading/ReactionTimings.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    class ReactionTimingController : public Reactor {
+    public:
+        explicit ReactionTimingController(std::unique_ptr<NUClear::Environment> environment)
+            : Reactor(std::move(environment)) {
+
+            on<Trigger<message::ReactionTimingConfiguration>, Sync<ReactionTimingController>>().then(
+                "Configure Reaction Timings",
+                [this](const message::ReactionTimingConfiguration& config) {
+                    summary_handle.unbind();
+
+                    // Throw away anything left over from before so the first summary only covers its interval
+                    std::map<NUClear::id_t, threading::ReactionTimings::Totals> stale;
+                    threading::ReactionTimings::drain(stale);
+
+                    const bool enabled = config.interval > clock::duration::zero();
+                    threading::ReactionTimings::set_enabled(enabled);
+                    if (enabled) {
+                        start          = clock::now();
+                        summary_handle = on<Every<>, Sync<ReactionTimingController>>(config.interval)
+                                             .then("Reaction Timing Summary", [this] { emit(summarise()); });
+                    }
+                });
+
+            on<Shutdown>().then("Shutdown Reaction Timings", [] { threading::ReactionTimings::set_enabled(false); });
+        }
+
+    private:
+        /// @brief Gets the quantiles of a histogram
+        static message::ReactionTimingSummary::Distribution distribution(const util::LatencyHistogram::Counts& c) {
+            message::ReactionTimingSummary::Distribution d;
+            d.p50 = std::chrono::duration_cast<clock::duration>(util::LatencyHistogram::value_at(c, 0.5));
+            d.p90 = std::chrono::duration_cast<clock::duration>(util::LatencyHistogram::value_at(c, 0.9));
+            d.p99 = std::chrono::duration_cast<clock::duration>(util::LatencyHistogram::value_at(c, 0.99));
+            d.max = std::chrono::duration_cast<clock::duration>(util::LatencyHistogram::value_at(c, 1.0));
+            return d;
+        }
+
+        /// @brief Drains the timings of every reaction since the last summary into a new summary
+        std::unique_ptr<message::ReactionTimingSummary> summarise() {
+            std::map<NUClear::id_t, threading::ReactionTimings::Totals> totals;
+            threading::ReactionTimings::drain(totals);
+
+            auto summary   = std::make_unique<message::ReactionTimingSummary>();
+            summary->start = start;
+            summary->end   = clock::now();
+            start          = summary->end;
+
+            for (const auto& t : totals) {
+                message::ReactionTimingSummary::Reaction reaction;
+                for (const auto& c : t.second.run_time) {
+                    reaction.count += c;
+                }
+                if (reaction.count == 0) {
+                    continue;
+                }
+                reaction.identifiers = t.second.identifiers;
+                reaction.reaction_id = t.first;
+                reaction.exceptions  = t.second.exceptions;
+                reaction.queue_delay = distribution(t.second.queue_delay);
+                reaction.run_time    = distribution(t.second.run_time);
+                summary->reactions.push_back(std::move(reaction));
+            }
+
+            return summary;
+        }
+
+        /// @brief The reaction that emits the summaries, while timings are enabled
+        ReactionHandle summary_handle;
+        /// @brief The start of the interval the next summary covers
+        clock::time_point start;
+    };
+
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_REACTIONTIMINGCONTROLLER_HPP
@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_SCHEDULERSTATISTICSCONTROLLER_HPP
+#define NUCLEAR_EXTENSION_SCHEDULERSTATISTICSCONTROLLER_HPP
+
+#include "../PowerPlant.hpp"
+#include "../Reactor.hpp"
+#include "../message/SchedulerStatistics.hpp"
+#include "../message/SchedulerStatisticsConfiguration.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    class SchedulerStatisticsController : public Reactor {
+    public:
+        explicit SchedulerStatisticsController(std::unique_ptr<NUClear::Environment> environment)
+            : Reactor(std::move(environment)) {
+
+            on<Trigger<message::SchedulerStatisticsConfiguration>, Sync<SchedulerStatisticsController>>().then(
+                "Configure Scheduler Statistics",
+                [this](const message::SchedulerStatisticsConfiguration& config) {
+                    statistics_handle.unbind();
+
+                    if (config.interval > clock::duration::zero()) {
+                        statistics_handle = on<Every<>, Sync<SchedulerStatisticsController>>(config.interval)
+                                                .then("Scheduler Statistics", [this] {
+                                                    emit(std::make_unique<message::SchedulerStatistics>(
+                                                        powerplant.scheduler_statistics()));
+                                                });
+                    }
+                });
+        }
+
+    private:
+        /// @brief The reaction that emits the statistics, while they are turned on
+        ReactionHandle statistics_handle;
+    };
+
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_SCHEDULERSTATISTICSCONTROLLER_HPP
@@ -0,0 +1,282 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_TRACEEXPORTER_HPP
+#define NUCLEAR_EXTENSION_TRACEEXPORTER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../PowerPlant.hpp"
+#include "../Reactor.hpp"
+#include "../message/ReactionStatistics.hpp"
+#include "../util/main_thread_id.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    /**
+     * @brief Records the tasks that run into ring buffers and writes them out as a Chrome trace.
+     *
+     * @details
+     *  This is not installed by default, install it to start tracing.
+     *  @code plant.install<NUClear::extension::TraceExporter>("trace.json"); @endcode
+     *  Each task's ReactionStatistics are kept as a small fixed size record in a ring buffer that belongs to the thread
+     *  that ran the task, and once a thread's buffer is full its oldest records are overwritten. Threads never share a
+     *  buffer so recording a task doesn't wait on other threads, and the names of threads and reactions are only
+     *  worked out when the trace is written.
+     *
+     *  When the powerplant shuts down the trace is written to the file in the Chrome trace event JSON format, which
+     *  can be opened in chrome://tracing or https://ui.perfetto.dev. Each thread is its own track and there is a flow
+     *  arrow from each task to the tasks it caused.
+     *
+     *  Since ReactionStatistics are emitted directly by the thread that ran the task, that is the thread recorded.
+     */
+    class TraceExporter : public Reactor {
+    public:
+        /**
+         * @brief Creates the exporter, which starts recording straight away
+         *
+         * @param environment the environment for this reactor
+         * @param path        the file to write the trace to when the powerplant shuts down, or empty to not write one
+         * @param capacity    the maximum number of tasks kept for each thread, after which the oldest are overwritten
+         */
+        TraceExporter(std::unique_ptr<NUClear::Environment> environment,
+                      std::string path       = "",
+                      const size_t& capacity = 65536)
+            : Reactor(std::move(environment)), path(std::move(path)), capacity(capacity == 0 ? 1 : capacity) {
+
+            on<Trigger<message::ReactionStatistics>>().then("Record Trace",
+                                                            [this](const message::ReactionStatistics& stats) {
+                                                                record(stats);
+                                                            });
+
+            on<Shutdown>().then("Write Trace", [this] {
+                if (!this->path.empty()) {
+                    std::ofstream out(this->path);
+                    write(out);
+                }
+            });
+        }
+
+        /**
+         * @brief Writes the tasks that are currently recorded as a Chrome trace event JSON document
+         *
+         * @param out the stream to write the trace to
+         */
+        void write(std::ostream& out) const {
+
+            // Copy everything out so we aren't holding any locks while writing, each thread is its own track
+            std::vector<Record> records;
+            std::vector<std::thread::id> thread_ids;
+            /* mutex scope */ {
+                const std::lock_guard<std::mutex> lock(rings_mutex);
+                for (const auto& ring : rings) {
+                    const std::lock_guard<std::mutex> ring_lock(ring->mutex);
+                    thread_ids.push_back(ring->thread);
+                    const size_t size = std::min(ring->count, ring->records.size());
+                    for (size_t i = ring->count - size; i < ring->count; ++i) {
+                        records.push_back(ring->records[i % ring->records.size()]);
+                        records.back().thread = uint32_t(thread_ids.size());
+                    }
+                }
+            }
+            std::sort(records.begin(), records.end(), [](const Record& a, const Record& b) {
+                return a.started < b.started;
+            });
+
+            // Times are written relative to the first task so they are small enough to be precise
+            int64_t origin = records.empty() ? 0 : records.front().emitted;
+            std::map<NUClear::id_t, const Record*> tasks;
+            for (const auto& r : records) {
+                origin         = std::min(origin, std::min(r.emitted, r.started));
+                tasks[r.task_id] = &r;
+            }
+            const auto time = [origin](const int64_t& t) { return double(t - origin) / 1000.0; };
+
+            out << std::fixed << std::setprecision(3);
+            out << R"({"displayTimeUnit":"ns","traceEvents":[)";
+            out << R"({"ph":"M","name":"process_name","pid":1,"tid":0,"args":{"name":"NUClear"}})";
+            for (size_t i = 0; i < thread_ids.size(); ++i) {
+                const std::string name =
+                    thread_ids[i] == util::main_thread_id ? "Main Thread" : "Thread " + std::to_string(i + 1);
+                out << R"(,{"ph":"M","name":"thread_name","pid":1,"tid":)" << i + 1 << R"(,"args":{"name":")" << name
+                    << R"("}})";
+            }
+
+            for (const auto& r : records) {
+                const auto& ids  = r.identifiers;
+                std::string name = "Reaction " + std::to_string(r.reaction_id);
+                if (ids != nullptr) {
+                    name = ids->name.empty() ? ids->dsl : ids->name;
+                }
+
+                // The task itself
+                out << R"(,{"ph":"X","pid":1,"tid":)" << r.thread << R"(,"ts":)" << time(r.started) << R"(,"dur":)"
+                    << double(r.finished - r.started) / 1000.0 << R"(,"name":")" << escape(name) << R"(","cat":")"
+                    << escape(ids != nullptr ? ids->reactor : "") << R"(","args":{"reaction_id":)" << r.reaction_id
+                    << R"(,"task_id":)" << r.task_id << R"(,"cause_task_id":)" << r.cause_task_id
+                    << R"(,"queue_delay_us":)" << double(r.started - r.emitted) / 1000.0 << R"(,"exception":)"
+                    << (r.exception ? "true" : "false") << "}}";
+
+                // A flow arrow from the point in the task that caused this one to the start of this one
+                auto cause = tasks.find(r.cause_task_id);
+                if (r.cause_task_id != 0 && cause != tasks.end()) {
+                    const Record& c     = *cause->second;
+                    const int64_t start = std::max(c.started, std::min(r.emitted, c.finished));
+                    out << R"(,{"ph":"s","name":"cause","cat":"flow","pid":1,"tid":)" << c.thread << R"(,"ts":)"
+                        << time(start) << R"(,"id":)" << r.task_id << "}";
+                    out << R"(,{"ph":"f","bp":"e","name":"cause","cat":"flow","pid":1,"tid":)" << r.thread
+                        << R"(,"ts":)" << time(r.started) << R"(,"id":)" << r.task_id << "}";
+                }
+            }
+            out << "]}\n";
+        }
+
+    private:
+        /// @brief What is kept about each task, times are in nanoseconds since the clock's epoch
+        struct Record {
+            NUClear::id_t reaction_id;
+            NUClear::id_t task_id;
+            NUClear::id_t cause_task_id;
+            int64_t emitted;
+            int64_t started;
+            int64_t finished;
+            bool exception;
+            /// @brief The names of the reaction, which are shared with the reaction so copying them doesn't allocate
+            std::shared_ptr<const threading::ReactionIdentifiers> identifiers;
+            /// @brief The track of the thread that ran the task, this is only filled in when the trace is written
+            uint32_t thread;
+        };
+
+        /// @brief The tasks recorded by one thread
+        struct ThreadRing {
+            ThreadRing(const std::thread::id& thread, const size_t& capacity) : thread(thread), records(capacity) {}
+            /// @brief The thread that records into this ring
+            const std::thread::id thread;
+            /// @brief Only ever contended when the trace is being written
+            std::mutex mutex;
+            /// @brief The ring buffer of tasks
+            std::vector<Record> records;
+            /// @brief The total number of tasks that have been recorded, the next goes at count % records.size()
+            size_t count{0};
+        };
+
+        /// @brief The ring the current thread records into, making one the first time this thread records a task
+        ThreadRing& thread_ring() {
+            // Remember which exporter the ring belongs to, so a thread used by several exporters finds each one's ring
+            struct Current {
+                uint64_t exporter{0};
+                ThreadRing* ring{nullptr};
+            };
+            static thread_local Current current;
+            if (current.exporter != instance) {
+                const auto id = std::this_thread::get_id();
+                const std::lock_guard<std::mutex> lock(rings_mutex);
+                auto it = std::find_if(rings.begin(), rings.end(), [&id](const std::unique_ptr<ThreadRing>& ring) {
+                    return ring->thread == id;
+                });
+                if (it == rings.end()) {
+                    rings.push_back(std::make_unique<ThreadRing>(id, capacity));
+                    it = std::prev(rings.end());
+                }
+                current = Current{instance, it->get()};
+            }
+            return *current.ring;
+        }
+
+        /// @brief Adds a task to this thread's ring buffer, overwriting the oldest if it is full
+        void record(const message::ReactionStatistics& stats) {
+            const auto ns = [](const clock::time_point& t) {
+                return int64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count());
+            };
+
+            ThreadRing& ring = thread_ring();
+            const std::lock_guard<std::mutex> lock(ring.mutex);
+            Record& r       = ring.records[ring.count++ % ring.records.size()];
+            r.reaction_id   = stats.reaction_id;
+            r.task_id       = stats.task_id;
+            r.cause_task_id = stats.cause_task_id;
+            r.emitted       = ns(stats.emitted);
+            r.started       = ns(stats.started);
+            r.finished      = ns(stats.finished);
+            r.exception     = stats.exception != nullptr;
+            r.identifiers   = stats.identifiers;
+        }
+
+        /// @brief Gives each exporter a different number so threads can tell them apart
+        static uint64_t next_instance() {
+            static std::atomic<uint64_t> source{1};
+            return source.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// @brief Escapes a string so it can be written inside a JSON string
+        static std::string escape(const std::string& s) {
+            std::ostringstream out;
+            for (const char& c : s) {
+                switch (c) {
+                    case '"': out << "\\\""; break;
+                    case '\\': out << "\\\\"; break;
+                    case '\n': out << "\\n"; break;
+                    case '\t': out << "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+                        }
+                        else {
+                            out << c;
+                        }
+                }
+            }
+            return out.str();
+        }
+
+        /// @brief The file to write the trace to on shutdown
+        std::string path;
+
+        /// @brief The number of tasks each thread's ring buffer holds
+        const size_t capacity;
+        /// @brief The number that identifies this exporter to the threads recording into it
+        const uint64_t instance{next_instance()};
+
+        /// @brief Protects the list of rings, which is only changed when a thread records its first task
+        mutable std::mutex rings_mutex;
+        /// @brief The ring buffer of each thread that has recorded a task, in the order they first recorded one
+        std::vector<std::unique_ptr<ThreadRing>> rings;
+    };
+
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_TRACEEXPORTER_HPP
@@ -23,7 +23,10 @@
 #ifndef NUCLEAR_MESSAGE_REACTIONSTATISTICS_HPP
 #define NUCLEAR_MESSAGE_REACTIONSTATISTICS_HPP
 
+#include <chrono>
+#include <cstdint>
 #include <exception>
+#include <memory>
 #include <string>
 #include <vector>
 #include "../id.hpp"
@@ -39,7 +42,7 @@ namespace message {
      */
     struct ReactionStatistics {
 
-        ReactionStatistics(threading::ReactionIdentifiers identifiers,
+        ReactionStatistics(std::shared_ptr<const threading::ReactionIdentifiers> identifiers,
                            const NUClear::id_t& reaction_id,
                            const NUClear::id_t& task_id,
                            const NUClear::id_t& cause_reaction_id,
@@ -58,8 +61,8 @@ namespace message {
             , finished(finish)
             , exception(std::move(exception)) {}
 
-        /// @brief A string containing the username/on arguments/and callback name of the reaction.
-        threading::ReactionIdentifiers identifiers;
+        /// @brief The username/on arguments/and callback name of the reaction, shared with the reaction itself.
+        std::shared_ptr<const threading::ReactionIdentifiers> identifiers;
         /// @brief The id of this reaction.
         NUClear::id_t reaction_id{0};
         /// @brief The task id of this reaction.
@@ -74,8 +77,19 @@ namespace message {
         clock::time_point started{};
         /// @brief The time that execution finished on this reaction
         clock::time_point finished{};
+        /// @brief The time that this reaction should have started by, or the maximum time point if it had no deadline
+        clock::time_point deadline{clock::time_point::max()};
         /// @brief An exception pointer that can be rethrown (if the reaction threw an exception)
         std::exception_ptr exception{nullptr};
+        /// @brief The cpu time the thread used while running this reaction, only recorded at StatisticsLevel::CPU.
+        /// When this is much less than the time between started and finished the reaction was waiting or preempted
+        std::chrono::nanoseconds cpu_time{0};
+        /// @brief The number of times the thread gave up the cpu while running this reaction, such as to wait on a
+        /// lock, only recorded at StatisticsLevel::CPU and on linux
+        uint64_t voluntary_context_switches{0};
+        /// @brief The number of times the thread was preempted while running this reaction, only recorded at
+        /// StatisticsLevel::CPU and on linux
+        uint64_t involuntary_context_switches{0};
     };
 
 }  // namespace message
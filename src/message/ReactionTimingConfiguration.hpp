@@ -0,0 +1,51 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_REACTIONTIMINGCONFIGURATION_HPP
+#define NUCLEAR_MESSAGE_REACTIONTIMINGCONFIGURATION_HPP
+
+#include "../clock.hpp"
+
+namespace NUClear {
+namespace message {
+
+    /**
+     * @brief Turns on the recording of reaction timings and sets how often a ReactionTimingSummary is emitted.
+     *
+     * @details
+     *  Timings are recorded into histograms as tasks finish rather than being emitted for every task like
+     *  ReactionStatistics, so they are cheap enough to leave on at high task rates.
+     */
+    struct ReactionTimingConfiguration {
+
+        ReactionTimingConfiguration() = default;
+
+        explicit ReactionTimingConfiguration(const clock::duration& interval) : interval(interval) {}
+
+        /// @brief How often a ReactionTimingSummary is emitted, if this is zero timings are not recorded
+        clock::duration interval{0};
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_REACTIONTIMINGCONFIGURATION_HPP
@@ -0,0 +1,87 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_REACTIONTIMINGSUMMARY_HPP
+#define NUCLEAR_MESSAGE_REACTIONTIMINGSUMMARY_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../clock.hpp"
+#include "../id.hpp"
+#include "../threading/ReactionIdentifiers.hpp"
+
+namespace NUClear {
+namespace message {
+
+    /**
+     * @brief A summary of how long the tasks of each reaction waited and ran for over an interval.
+     *
+     * @details This is emitted periodically once it has been turned on with a ReactionTimingConfiguration
+     */
+    struct ReactionTimingSummary {
+
+        /**
+         * @brief Quantiles of a set of durations.
+         *
+         * @details Each is the upper bound of the histogram bucket it is in, which is within 1/8 of the true value
+         */
+        struct Distribution {
+            /// @brief The median duration
+            clock::duration p50{0};
+            /// @brief The 90th percentile duration
+            clock::duration p90{0};
+            /// @brief The 99th percentile duration
+            clock::duration p99{0};
+            /// @brief The longest duration
+            clock::duration max{0};
+        };
+
+        /// @brief The timings of one reaction
+        struct Reaction {
+            /// @brief The identifiers of the reaction
+            std::shared_ptr<const threading::ReactionIdentifiers> identifiers{};
+            /// @brief The id of the reaction
+            NUClear::id_t reaction_id{0};
+            /// @brief The number of tasks that finished during the interval
+            uint64_t count{0};
+            /// @brief The number of tasks that threw an exception during the interval
+            uint64_t exceptions{0};
+            /// @brief The time from when each task was created until it started running
+            Distribution queue_delay{};
+            /// @brief The time each task took to run
+            Distribution run_time{};
+        };
+
+        /// @brief The start of the interval this summary covers
+        clock::time_point start{};
+        /// @brief The end of the interval this summary covers
+        clock::time_point end{};
+        /// @brief The reactions that had tasks finish during the interval, in order of their id
+        std::vector<Reaction> reactions{};
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_REACTIONTIMINGSUMMARY_HPP
@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_SCHEDULERSTATISTICS_HPP
+#define NUCLEAR_MESSAGE_SCHEDULERSTATISTICS_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "../clock.hpp"
+#include "../id.hpp"
+
+namespace NUClear {
+namespace message {
+
+    /**
+     * @brief A snapshot of how busy the TaskScheduler and each of its thread pools are.
+     *
+     * @details
+     *  This can be pulled at any time from PowerPlant::scheduler_statistics, or emitted periodically once it has been
+     *  turned on with a SchedulerStatisticsConfiguration. The gauges are the state at the time of the snapshot while
+     *  the counters are totals since the scheduler was created, so the difference between two snapshots gives the
+     *  rate over the time between them.
+     */
+    struct SchedulerStatistics {
+
+        /// @brief The state of one thread pool
+        struct Pool {
+            /// @brief The id of the thread pool
+            NUClear::id_t pool_id{0};
+            /// @brief The number of threads running in the pool
+            uint64_t threads{0};
+            /// @brief The number of tasks waiting in the pool's queues
+            uint64_t queue_depth{0};
+            /// @brief The number of the pool's tasks that are waiting for a slot in their group
+            uint64_t parked{0};
+            /// @brief The number of threads that are asleep waiting for a task
+            uint64_t sleeping{0};
+            /// @brief The number of threads that are spinning looking for a task
+            uint64_t spinning{0};
+
+            /// @brief The total number of tasks that have been queued to run in this pool
+            uint64_t tasks_submitted{0};
+            /// @brief The total number of times tasks were added to the pool's queues, all of the pool's tasks from a
+            /// batch are added at once so this is less than tasks_submitted when tasks are emitted in batches
+            uint64_t enqueues{0};
+            /// @brief The total number of tasks that the pool's threads have run
+            uint64_t tasks_run{0};
+            /// @brief The total number of times a thread went to sleep waiting for a task
+            uint64_t waits{0};
+            /// @brief The total time the pool's threads have spent asleep waiting for a task
+            clock::duration wait_time{0};
+            /// @brief The total number of times a thread spun looking for a task before it would go to sleep
+            uint64_t spins{0};
+            /// @brief The total number of times a task arrived while a thread was spinning, so it didn't need to sleep
+            uint64_t spin_hits{0};
+            /// @brief The total number of times a thread looked in the queues and found nothing it could run
+            uint64_t rescans{0};
+            /// @brief The total number of tasks that had to wait for a slot in their group
+            uint64_t parks{0};
+            /// @brief The total number of times a queue lock for this pool was already held when a thread wanted it
+            uint64_t queue_lock_contended{0};
+            /// @brief The total number of times a group lock was already held when one of this pool's threads wanted it
+            uint64_t group_lock_contended{0};
+        };
+
+        /// @brief When the snapshot was taken
+        clock::time_point timestamp{};
+        /// @brief The total number of tasks that started after their deadline
+        uint64_t missed_deadlines{0};
+        /// @brief The state of each of the thread pools, in order of their id
+        std::vector<Pool> pools{};
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_SCHEDULERSTATISTICS_HPP
@@ -28,8 +28,13 @@ namespace threading {
     // Initialize our reaction source
     std::atomic<NUClear::id_t> Reaction::reaction_id_source(0);  // NOLINT
 
+    // Initialize our count of statistics subscribers
+    std::atomic<size_t> Reaction::statistics_subscribers(0);  // NOLINT
+
     Reaction::Reaction(Reactor& reactor, ReactionIdentifiers&& identifiers, TaskGenerator&& generator)
-        : reactor(reactor), identifiers(std::move(identifiers)), generator(std::move(generator)) {}
+        : reactor(reactor)
+        , identifiers(std::make_shared<const ReactionIdentifiers>(std::move(identifiers)))
+        , generator(std::move(generator)) {}
 
     void Reaction::unbind() {
         // Unbind
@@ -24,12 +24,15 @@
 #define NUCLEAR_THREADING_REACTION_HPP
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <string>
 #include "../id.hpp"
 #include <utility>
 
+#include "../StatisticsLevel.hpp"
 #include "../util/GeneratedCallback.hpp"
 #include "ReactionIdentifiers.hpp"
 #include "ReactionTask.hpp"
@@ -87,6 +90,7 @@ namespace threading {
             if (callback) {
                 return std::make_unique<ReactionTask>(*this,
                                                       callback.priority,
+                                                      callback.deadline,
                                                       callback.group,
                                                       callback.pool,
                                                       std::move(callback.callback));
@@ -104,8 +108,8 @@ namespace threading {
         /// @brief the reactor this belongs to
         Reactor& reactor;
 
-        /// @brief This holds the identifying strings for this reaction
-        ReactionIdentifiers identifiers;
+        /// @brief This holds the identifying strings for this reaction, which are shared with its statistics
+        const std::shared_ptr<const ReactionIdentifiers> identifiers;
 
         /// @brief the unique identifier for this Reaction object
         const NUClear::id_t id{++reaction_id_source};
@@ -113,9 +117,19 @@ namespace threading {
         /// @brief if this is false, we cannot emit ReactionStatistics from any reaction triggered by this one
         bool emit_stats{true};
 
+        /// @brief how much is recorded in the ReactionStatistics of this reaction's tasks when something is listening
+        std::atomic<StatisticsLevel> statistics_level{StatisticsLevel::FULL};
+
+        /// @brief the number of reactions bound to ReactionStatistics, statistics are only recorded if non zero
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        static std::atomic<size_t> statistics_subscribers;
+
         /// @brief the number of currently active tasks (existing reaction tasks)
         std::atomic<int> active_tasks{0};
 
+        /// @brief the time in nanoseconds when the token bucket of the RateLimit word will be full again
+        std::atomic<int64_t> rate_limit_time{std::numeric_limits<int64_t>::min()};
+
         /// @brief if this reaction object is currently enabled
         std::atomic<bool> enabled{true};
 
@@ -109,6 +109,23 @@ namespace threading {
             return c ? bool(c->enabled) : false;
         }
 
+        /**
+         * @brief
+         *  Sets how much is recorded in the ReactionStatistics of the reaction's tasks.
+         *  This only takes effect while something is bound to ReactionStatistics, and only for tasks created after it
+         *  is changed.
+         *
+         * @param level
+         *  the statistics level for the reaction
+         */
+        inline ReactionHandle& statistics(const StatisticsLevel& level) {
+            auto c = context.lock();
+            if (c) {
+                c->statistics_level = level;
+            }
+            return *this;
+        }
+
         /**
          * @brief
          *  Removes a reaction request from the runtime environment.  This action is not reversible, once a reaction has
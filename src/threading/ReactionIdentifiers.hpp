@@ -30,6 +30,10 @@ namespace threading {
 
     /**
      * @brief This struct holds string fields that can be used to identify a reaction.
+     *
+     * @details
+     *  The dsl and function strings are full demangled type names that can be hundreds of characters long, so each
+     *  Reaction makes one of these and everything else shares it rather than copying the strings.
      */
     struct ReactionIdentifiers {
 
@@ -24,16 +24,20 @@
 #define NUCLEAR_THREADING_REACTIONTASK_HPP
 
 #include <atomic>
-#include <functional>
+#include <cstddef>
 #include <memory>
 #include <typeindex>
 #include <vector>
 
+#include "../StatisticsLevel.hpp"
 #include "../id.hpp"
 #include "../message/ReactionStatistics.hpp"
+#include "../util/FreeList.hpp"
 #include "../util/GroupDescriptor.hpp"
+#include "../util/InlineFunction.hpp"
 #include "../util/ThreadPoolDescriptor.hpp"
 #include "../util/platform.hpp"
+#include "ReactionTimings.hpp"
 
 namespace NUClear {
 namespace threading {
@@ -57,8 +61,8 @@ namespace threading {
         static ATTRIBUTE_TLS Task* current_task;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
     public:
-        /// Type of the functions that ReactionTasks execute
-        using TaskFunction = std::function<void(Task<ReactionType>&)>;
+        /// Type of the functions that ReactionTasks execute, which are stored in the task if they are small enough
+        using TaskFunction = util::InlineFunction<void(Task<ReactionType>&), 96>;
 
         /**
          * @brief Gets the current executing task, or nullptr if there isn't one.
@@ -74,31 +78,79 @@ namespace threading {
          *
          * @param parent                 the Reaction object that spawned this ReactionTask.
          * @param priority               the priority to use when executing this task.
+         * @param deadline               how long after it is created this task should start by, or max for none
          * @param group_descriptor       the descriptor for the group that this task should run in
          * @param thread_pool_descriptor the descriptor for the thread pool that this task should be queued in
          * @param callback               the data bound callback to be executed in the thread pool.
          */
         Task(ReactionType& parent,
              const int& priority,
+             const clock::duration& deadline,
              const util::GroupDescriptor& group_descriptor,
              const util::ThreadPoolDescriptor& thread_pool_descriptor,
              TaskFunction&& callback)
             : parent(parent)
             , priority(priority)
-            , stats(std::make_shared<message::ReactionStatistics>(parent.identifiers,
-                                                                  parent.id,
-                                                                  id,
-                                                                  current_task != nullptr ? current_task->parent.id : 0,
-                                                                  current_task != nullptr ? current_task->id : 0,
-                                                                  clock::now(),
-                                                                  clock::time_point(std::chrono::seconds(0)),
-                                                                  clock::time_point(std::chrono::seconds(0)),
-                                                                  nullptr))
+            , cause_reaction_id(current_task != nullptr ? current_task->parent.id : 0)
+            , cause_task_id(current_task != nullptr ? current_task->id : 0)
             , emit_stats(parent.emit_stats && (current_task != nullptr ? current_task->emit_stats : true))
+            , statistics_level(emit_stats && ReactionType::statistics_subscribers.load(std::memory_order_relaxed) != 0
+                                   ? parent.statistics_level.load(std::memory_order_relaxed)
+                                   : StatisticsLevel::NONE)
+            , timed(ReactionTimings::enabled())
+            , emitted(statistics_level != StatisticsLevel::NONE || timed || deadline != clock::duration::max()
+                          ? clock::now()
+                          : clock::time_point(std::chrono::seconds(0)))
+            , stats(statistics_level == StatisticsLevel::NONE
+                        ? nullptr
+                        : make_statistics(emitted))
+            , deadline(deadline == clock::duration::max() ? clock::time_point::max() : emitted + deadline)
             , group_descriptor(group_descriptor)
             , thread_pool_descriptor(thread_pool_descriptor)
-            , callback(std::move(callback)) {}
+            , callback(std::move(callback)) {
+            if (stats != nullptr) {
+                stats->deadline = this->deadline;
+            }
+        }
+
+        /**
+         * @brief Gets a full record of this task's statistics, such as for identifying the task that logged a message.
+         *
+         * @details
+         *  If this task is recording everything these are its statistics. Otherwise this is a copy of whatever has been
+         *  recorded, any times that were not recorded are left as zero.
+         *
+         * @return the statistics of this task including the reaction's identifiers
+         */
+        std::shared_ptr<message::ReactionStatistics> full_statistics() const {
+            if (statistics_level >= StatisticsLevel::FULL) {
+                return stats;
+            }
+            if (stats == nullptr) {
+                auto full      = make_statistics(clock::time_point(std::chrono::seconds(0)));
+                full->deadline = deadline;
+                return full;
+            }
+            return std::make_shared<message::ReactionStatistics>(*stats);
+        }
+
+
+        /**
+         * @brief Allocates memory for a task, reusing the memory of a finished task where possible.
+         *
+         * @details Tasks are created for every message that triggers a reaction, so they are recycled to keep the
+         *          heap out of the path from an emit to running a reaction
+         */
+        static void* operator new(std::size_t size) {
+            return util::FreeList<sizeof(Task)>::allocate(size);
+        }
 
+        /**
+         * @brief Frees the memory of a task so it can be reused by the next task.
+         */
+        static void operator delete(void* ptr, std::size_t size) noexcept {
+            util::FreeList<sizeof(Task)>::deallocate(ptr, size);
+        }
 
         /**
          * @brief Runs the internal data bound task and times it.
@@ -109,14 +161,40 @@ namespace threading {
          */
         inline void run() {
 
-            // Update our current task
-            const std::shared_ptr<Task> lock(current_task, [](Task* t) { current_task = t; });
+            // Update our current task, and put the previous one back when we are done even if the callback throws
+            struct RestoreCurrentTask {  // NOLINT(cppcoreguidelines-special-member-functions)
+                ~RestoreCurrentTask() {
+                    current_task = previous;
+                }
+                Task* previous;
+            } const restore{current_task};
             current_task = this;
 
             // Run our callback
             callback(*this);
         }
 
+        /**
+         * @brief Creates a new statistics record for this task
+         *
+         * @details The record always shares the reaction's identifiers, which only costs a reference count
+         *
+         * @param emitted the time the task was emitted
+         *
+         * @return the new statistics record
+         */
+        std::shared_ptr<message::ReactionStatistics> make_statistics(const clock::time_point& emitted) const {
+            return std::make_shared<message::ReactionStatistics>(parent.identifiers,
+                                                                 parent.id,
+                                                                 id,
+                                                                 cause_reaction_id,
+                                                                 cause_task_id,
+                                                                 emitted,
+                                                                 clock::time_point(std::chrono::seconds(0)),
+                                                                 clock::time_point(std::chrono::seconds(0)),
+                                                                 nullptr);
+        }
+
         /**
          * @brief Generate a new unique task id
          *
@@ -132,11 +210,24 @@ namespace threading {
         NUClear::id_t id{new_task_id()};
         /// @brief the priority to run this task at
         int priority;
-        /// @brief the statistics object that persists after this for information and debugging
-        std::shared_ptr<message::ReactionStatistics> stats;
+        /// @brief the id of the reaction that was running when this task was created, or 0 if there was not one
+        NUClear::id_t cause_reaction_id;
+        /// @brief the id of the task that was running when this task was created, or 0 if there was not one
+        NUClear::id_t cause_task_id;
         /// @brief if these stats are safe to emit. It should start true, and as soon as we are a reaction based on
         /// reaction statistics becomes false for all created tasks. This is to stop infinite loops of death.
         bool emit_stats;
+        /// @brief how much this task records in its statistics, this is NONE if nothing is listening for them
+        StatisticsLevel statistics_level;
+        /// @brief if this task records how long it waited and ran for in the ReactionTimings histograms
+        bool timed;
+        /// @brief the time this task was created, this is only set if it has statistics, is timed or has a deadline
+        clock::time_point emitted;
+        /// @brief the statistics object that persists after this for information and debugging, or nullptr if this
+        /// task is not recording statistics
+        std::shared_ptr<message::ReactionStatistics> stats;
+        /// @brief the time this task should start by, or the maximum time point if it has no deadline
+        clock::time_point deadline;
 
         /// @brief details about the group that this task will run in
         util::GroupDescriptor group_descriptor;
@@ -0,0 +1,126 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ReactionTimings.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NUClear {
+namespace threading {
+
+    namespace {
+
+        /// @brief The histograms for one reaction on one thread
+        struct Entry {
+            explicit Entry(std::shared_ptr<const ReactionIdentifiers> identifiers)
+                : identifiers(std::move(identifiers)) {}
+            std::shared_ptr<const ReactionIdentifiers> identifiers;
+            util::LatencyHistogram queue_delay;
+            util::LatencyHistogram run_time;
+            std::atomic<uint64_t> exceptions{0};
+        };
+
+        /// @brief The histograms for every reaction that has run on one thread
+        struct Table {
+            /// @brief Held to add entries, and while the entries are being drained, but not while recording
+            std::mutex mutex;
+            std::unordered_map<NUClear::id_t, std::unique_ptr<Entry>> entries;
+        };
+
+        /// @brief The tables of every thread that has recorded timings
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<Table>> tables;
+        };
+
+        Registry& registry() {
+            static Registry r;
+            return r;
+        }
+
+        /// @brief Gets the table for the current thread, adding it to the registry the first time
+        Table& local_table() {
+            static thread_local std::shared_ptr<Table> table = [] {
+                auto t = std::make_shared<Table>();
+                const std::lock_guard<std::mutex> lock(registry().mutex);
+                registry().tables.push_back(t);
+                return t;
+            }();
+            return *table;
+        }
+
+    }  // namespace
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    std::atomic<bool> ReactionTimings::is_enabled{false};
+
+    void ReactionTimings::record(const NUClear::id_t& reaction_id,
+                                 const std::shared_ptr<const ReactionIdentifiers>& identifiers,
+                                 const clock::duration& queue_delay,
+                                 const clock::duration& run_time,
+                                 const bool& exception) {
+        Table& table = local_table();
+
+        // Only this thread adds entries so it can look them up without the lock
+        auto it = table.entries.find(reaction_id);
+        if (it == table.entries.end()) {
+            const std::lock_guard<std::mutex> lock(table.mutex);
+            it = table.entries.emplace(reaction_id, std::make_unique<Entry>(identifiers)).first;
+        }
+
+        Entry& entry = *it->second;
+        entry.queue_delay.record(queue_delay);
+        entry.run_time.record(run_time);
+        if (exception) {
+            entry.exceptions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void ReactionTimings::drain(std::map<NUClear::id_t, Totals>& totals) {
+        const std::lock_guard<std::mutex> registry_lock(registry().mutex);
+        auto& tables = registry().tables;
+
+        for (const auto& table : tables) {
+            const std::lock_guard<std::mutex> lock(table->mutex);
+            for (auto& e : table->entries) {
+                Totals& t = totals[e.first];
+                if (t.identifiers == nullptr) {
+                    t.identifiers = e.second->identifiers;
+                }
+                e.second->queue_delay.drain(t.queue_delay);
+                e.second->run_time.drain(t.run_time);
+                t.exceptions += e.second->exceptions.exchange(0, std::memory_order_relaxed);
+            }
+        }
+
+        // Once a thread has exited only the registry holds its table, and now that it is drained it can go
+        tables.erase(std::remove_if(tables.begin(),
+                                    tables.end(),
+                                    [](const std::shared_ptr<Table>& table) { return table.use_count() == 1; }),
+                     tables.end());
+    }
+
+}  // namespace threading
+}  // namespace NUClear
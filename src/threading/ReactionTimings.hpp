@@ -0,0 +1,107 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_REACTIONTIMINGS_HPP
+#define NUCLEAR_THREADING_REACTIONTIMINGS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+
+#include "../clock.hpp"
+#include "../id.hpp"
+#include "../util/LatencyHistogram.hpp"
+#include "ReactionIdentifiers.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * @brief Collects how long each reaction's tasks wait to start and take to run, as histograms rather than events.
+     *
+     * @details
+     *  Each thread records into its own table of histograms, one entry per reaction that has run on it, so recording
+     *  only takes a lock the first time a reaction runs on a thread. The tables are drained into totals for each
+     *  reaction by whoever is summarising them, which resets the histograms for the next interval.
+     *
+     *  Nothing is recorded unless timings are enabled.
+     */
+    class ReactionTimings {
+    public:
+        /// @brief The timings recorded for one reaction, merged from all the threads it ran on
+        struct Totals {
+            /// @brief The identifiers of the reaction
+            std::shared_ptr<const ReactionIdentifiers> identifiers;
+            /// @brief The time from when each task was created until it started running
+            util::LatencyHistogram::Counts queue_delay{};
+            /// @brief The time each task took to run
+            util::LatencyHistogram::Counts run_time{};
+            /// @brief The number of tasks that threw an exception
+            uint64_t exceptions{0};
+        };
+
+        /// @brief If timings are being recorded
+        static bool enabled() noexcept {
+            return is_enabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Sets if timings are recorded, this applies to tasks created after it is changed
+         *
+         * @param enabled if timings should be recorded
+         */
+        static void set_enabled(const bool& enabled) noexcept {
+            is_enabled.store(enabled, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Records the timing of a task that has finished running on the current thread
+         *
+         * @param reaction_id the id of the reaction the task was for
+         * @param identifiers the identifiers of the reaction the task was for
+         * @param queue_delay the time from when the task was created until it started running
+         * @param run_time    the time the task took to run
+         * @param exception   if the task threw an exception
+         */
+        static void record(const NUClear::id_t& reaction_id,
+                           const std::shared_ptr<const ReactionIdentifiers>& identifiers,
+                           const clock::duration& queue_delay,
+                           const clock::duration& run_time,
+                           const bool& exception);
+
+        /**
+         * @brief Adds the timings every thread has recorded since the last drain to the totals for each reaction
+         *
+         * @param totals the totals to add to, indexed by reaction id
+         */
+        static void drain(std::map<NUClear::id_t, Totals>& totals);
+
+    private:
+        /// @brief If timings are being recorded
+        static std::atomic<bool> is_enabled;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_REACTIONTIMINGS_HPP
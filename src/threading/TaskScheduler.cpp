@@ -24,92 +24,356 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <mutex>
+#include <stdexcept>
 #include <system_error>
+#include <thread>
 
+#include "../PowerPlant.hpp"
 #include "../dsl/word/MainThread.hpp"
+#include "../util/TypeList.hpp"
+#include "../util/set_current_thread_affinity.hpp"
 #include "../util/update_current_thread_priority.hpp"
 
 namespace NUClear {
 namespace threading {
 
-    bool TaskScheduler::is_runnable(const util::GroupDescriptor& group) {
+    namespace {
+        /// @brief Tells the cpu that we are in a spin loop so it can save power and give way to sibling hyperthreads
+        inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+            asm volatile("yield");
+#endif
+        }
 
-        // Default group is always runnable
-        if (group.group_id == 0) {
-            return true;
+        /// @brief Locks a mutex, counting it as contended if another thread already held it
+        std::unique_lock<std::mutex> lock_counted(std::mutex& mutex, std::atomic<uint64_t>* contended) {
+            std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+            if (!lock.owns_lock()) {
+                if (contended != nullptr) {
+                    contended->fetch_add(1, std::memory_order_relaxed);
+                }
+                lock.lock();
+            }
+            return lock;
         }
 
-        if (groups.count(group.group_id) == 0) {
-            groups[group.group_id] = 0;
+        /// @brief Adds the time since a thread went to sleep to the total time spent waiting
+        void add_wait_time(std::atomic<uint64_t>& total, const std::chrono::steady_clock::time_point& start) {
+            const auto slept = std::chrono::steady_clock::now() - start;
+            total.fetch_add(uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(slept).count()),
+                            std::memory_order_relaxed);
         }
 
-        // Task can run if the group it belongs to has spare threads
-        if (groups.at(group.group_id) < group.thread_count) {
-            // This task is about to run in this group, increase the number of active tasks in the group
-            groups.at(group.group_id)++;
-            return true;
+        /// @brief The shard that the next thread to ask for one is given
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        std::atomic<size_t> next_counter_shard{0};
+        /// @brief One more than the shard of counters the current thread uses, or zero if it hasn't been given one
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        ATTRIBUTE_TLS size_t current_counter_shard = 0;
+    }  // namespace
+
+    TaskScheduler::PoolCounters& TaskScheduler::counters(PoolQueue& pool) {
+        if (current_counter_shard == 0) {
+            current_counter_shard = next_counter_shard.fetch_add(1, std::memory_order_relaxed) % COUNTER_SHARDS + 1;
         }
+        return pool.counters[current_counter_shard - 1];
+    }
 
+    TaskScheduler::GroupState& TaskScheduler::get_group(const NUClear::id_t& group_id) {
+
+        // Groups past the end of the table are rare so they are kept in a map, which never moves its elements
+        const size_t chunk = group_id / GROUP_CHUNK_SIZE;
+        if (chunk >= group_chunks.size()) {
+            const std::lock_guard<std::mutex> lock(overflow_groups_mutex);
+            return overflow_groups[group_id];
+        }
+
+        // The first task to use a group in this chunk creates the chunk, if another thread beats us we use theirs
+        GroupState* states = group_chunks[chunk].load(std::memory_order_acquire);
+        if (states == nullptr) {
+            std::unique_ptr<GroupState[]> fresh(new GroupState[GROUP_CHUNK_SIZE]);  // NOLINT(modernize-avoid-c-arrays)
+            if (group_chunks[chunk].compare_exchange_strong(states, fresh.get(), std::memory_order_acq_rel)) {
+                states = fresh.release();
+            }
+        }
+
+        return states[group_id % GROUP_CHUNK_SIZE];
+    }
+
+    bool TaskScheduler::acquire_slot(GroupState& state, const size_t& thread_count) {
+        size_t active = state.active.load();
+        while (active < thread_count) {
+            if (state.active.compare_exchange_weak(active, active + 1)) {
+                return true;
+            }
+        }
         return false;
     }
 
+    bool TaskScheduler::is_runnable(const util::GroupDescriptor& group) {
+
+        // Default group is always runnable
+        if (group.group_id == 0) {
+            return true;
+        }
+
+        // Tasks that are already waiting on this group get the next free slot before any new task does
+        GroupState& state = get_group(group.group_id);
+        return state.waiting_count.load() == 0 && acquire_slot(state, group.thread_count);
+    }
+
     void TaskScheduler::run_task(Task&& task) {
+        // Only tasks that have a deadline need to look at the clock
+        if (task.deadline != NUClear::clock::time_point::max() && NUClear::clock::now() > task.deadline) {
+            missed_deadline_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
         task.run();
 
         // We need to do group counting if this isn't the default group
         if (task.group_descriptor.group_id != 0) {
-            const std::lock_guard<std::mutex> group_lock(group_mutex);
-            --groups.at(task.group_descriptor.group_id);
+            GroupState& state = get_group(task.group_descriptor.group_id);
+            state.active.fetch_sub(1);
+
+            // If there are tasks waiting on this group, hand the free slot to the best of them
+            if (state.waiting_count.load() != 0) {
+                Task next;
+                bool released = false;
+                /* mutex scope */ {
+                    const auto group_lock = lock_counted(
+                        state.mutex,
+                        current_queue != nullptr ? &counters(**current_queue).group_lock_contended : nullptr);
+                    if (!state.waiting.empty() && acquire_slot(state, task.group_descriptor.thread_count)) {
+                        released = state.waiting.pop(next);
+                        state.waiting_count.fetch_sub(1);
+                        next.group_reserved = true;
+                    }
+                }
+
+                // Put the waiting task back in its pool to be run
+                if (released) {
+                    const std::shared_ptr<PoolQueue> pool = get_pool_queue(next.thread_pool_descriptor);
+                    const auto queue_lock = lock_counted(pool->mutex, &counters(*pool).queue_lock_contended);
+                    pool->queue.push(std::move(next));
+                    pool->top_priority.store(pool->queue.top_priority());
+                    pool->parked.fetch_sub(1);
+                    pool->condition.notify_one();
+                }
+            }
         }
     }
 
-    void TaskScheduler::pool_func(std::shared_ptr<PoolQueue> pool) {
+    bool TaskScheduler::park(PoolQueue& pool, Task& task) {
+        GroupState& state = get_group(task.group_descriptor.group_id);
+        const auto group_lock = lock_counted(state.mutex, &counters(pool).group_lock_contended);
+
+        // Once we are counted as waiting any thread releasing a slot will look at the wait list. If a slot was released
+        // before that then we will see it here, so either way this task can't be left waiting while the group is free
+        state.waiting_count.fetch_add(1);
+        if (acquire_slot(state, task.group_descriptor.thread_count)) {
+            state.waiting_count.fetch_sub(1);
+            return false;
+        }
+
+        state.waiting.push(std::move(task));
+        pool.parked.fetch_add(1);
+        counters(pool).parks.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool TaskScheduler::take_runnable(PoolQueue& pool,
+                                      util::RunQueue<Task>& queue,
+                                      std::atomic<int>& top_priority,
+                                      Task& task) {
+
+        // Take tasks in priority order until we find one that we can run
+        Task next;
+        bool found = false;
+        while (!found && queue.pop(next)) {
+            // If the group for this task is full it waits with the group until a slot is released
+            if (next.group_reserved || is_runnable(next.group_descriptor) || !park(pool, next)) {
+                task  = std::move(next);
+                found = true;
+            }
+        }
+
+        // Update what the best task in this queue is
+        top_priority.store(queue.top_priority(), std::memory_order_relaxed);
+        return found;
+    }
+
+    bool TaskScheduler::pool_empty(PoolQueue& pool) {
+        /* mutex scope */ {
+            const std::lock_guard<std::mutex> lock(pool.mutex);
+            if (!pool.queue.empty()) {
+                return false;
+            }
+        }
+        for (const auto& local : pool.local_queues) {
+            const std::lock_guard<std::mutex> lock(local->mutex);
+            if (!local->queue.empty()) {
+                return false;
+            }
+        }
+        // Tasks only move from the queues to their group so this must be checked last
+        return pool.parked.load() == 0;
+    }
+
+    void TaskScheduler::pool_func(std::shared_ptr<PoolQueue> pool, LocalQueue* local) {
 
         // Set the thread pool for this thread so it can be accessed elsewhere
-        current_queue = &pool;
+        NextTask next;
+        current_queue       = &pool;
+        current_local_queue = local;
+        current_next_task   = &next;
+
+        // Place the thread where the pool asked for it, the main thread belongs to the user so is left alone
+        // The thread still runs if it can't be placed, but it is worth knowing the pool isn't where it was asked to be
+        const auto& options = pool->options;
+        const auto& pool_id = pool->pool_descriptor.pool_id;
+        if (pool_id != util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID) {
+            const int numa_error = util::set_current_thread_numa_node(options.numa_node);
+            if (numa_error != 0) {
+                NUClear::log<NUClear::WARN>("Could not set the numa node of a thread in pool",
+                                            pool_id,
+                                            "to",
+                                            options.numa_node,
+                                            ":",
+                                            std::system_category().message(numa_error));
+            }
+            const int affinity_error = util::set_current_thread_affinity(
+                options.cpu_set.any() || options.numa_node < 0 ? options.cpu_set
+                                                               : util::numa_node_cpus(options.numa_node));
+            if (affinity_error != 0) {
+                NUClear::log<NUClear::WARN>("Could not set the cpu affinity of a thread in pool",
+                                            pool_id,
+                                            ":",
+                                            std::system_category().message(affinity_error));
+            }
+        }
 
         // When task is nullptr there are no more tasks to get and the scheduler is shutting down
-        while (running.load() || !pool->queue.empty()) {
+        while (running.load() || next.full || !pool_empty(*pool)) {
             try {
                 // Run the next task
                 run_task(get_task());
+                counters(*pool).run.fetch_add(1, std::memory_order_relaxed);
+
+                // Between tasks this thread isn't using any reaction lists, so it can drop any that are out of date
+                util::TypeListCache::release_stale();
+            }
+            catch (const RetireThreadException&) {
+                break;
             }
             catch (...) {
             }
         }
 
         // Clear the current queue
-        current_queue = nullptr;
+        current_queue       = nullptr;
+        current_local_queue = nullptr;
+        current_next_task   = nullptr;
     }
 
-    TaskScheduler::TaskScheduler(const size_t& thread_count) {
+    TaskScheduler::TaskScheduler(const Configuration& config)
+        : work_stealing(config.work_stealing)
+        , default_pool_options{config.spin_duration,
+                               config.cpu_set,
+                               config.numa_node,
+                               config.scheduling_policy,
+                               config.max_thread_count,
+                               config.grow_queue_depth,
+                               config.grow_wait_time,
+                               config.idle_timeout} {
+        util::set_thread_priority_policy(config.thread_priority_policy);
+
+        for (auto& chunk : group_chunks) {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+
         // Make the queue for the main thread
-        pool_queues[util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID] =
-            std::make_shared<PoolQueue>(util::ThreadPoolDescriptor{util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID, 1});
+        pool_queues[util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID] = std::make_shared<PoolQueue>(
+            util::ThreadPoolDescriptor{util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID, 1},
+            util::ThreadPoolOptions{});
 
         // Make the default pool with the correct number of threads
-        get_pool_queue(util::ThreadPoolDescriptor{util::ThreadPoolDescriptor::DEFAULT_THREAD_POOL_ID, thread_count});
+        get_pool_queue(util::ThreadPoolDescriptor{util::ThreadPoolDescriptor::DEFAULT_THREAD_POOL_ID,
+                                                  config.thread_count,
+                                                  &default_pool_options});
+    }
+
+    TaskScheduler::~TaskScheduler() {
+        for (auto& chunk : group_chunks) {
+            delete[] chunk.load();  // NOLINT(cppcoreguidelines-owning-memory)
+        }
     }
 
     void TaskScheduler::start_threads(const std::shared_ptr<PoolQueue>& pool) {
         // The main thread never needs to be started
         if (pool->pool_descriptor.pool_id != util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID) {
             const std::lock_guard<std::mutex> lock(pool->mutex);
+
+            // All the local queues must exist before any thread starts so that threads can safely steal from them
+            if (work_stealing) {
+                while (pool->local_queues.size() < pool->pool_descriptor.thread_count) {
+                    pool->local_queues.emplace_back(std::make_unique<LocalQueue>(
+                        pool->options.scheduling_policy == util::SchedulingPolicy::EARLIEST_DEADLINE_FIRST));
+                }
+            }
+
             while (pool->threads.size() < pool->pool_descriptor.thread_count) {
-                pool->threads.emplace_back(std::make_unique<std::thread>(&TaskScheduler::pool_func, this, pool));
+                LocalQueue* local = work_stealing ? pool->local_queues[pool->threads.size()].get() : nullptr;
+                pool->threads.emplace_back(std::make_unique<std::thread>(&TaskScheduler::pool_func, this, pool, local));
             }
+            pool->live_threads = pool->threads.size();
         }
     }
 
+    bool TaskScheduler::is_elastic(const PoolQueue& pool) const {
+        return !work_stealing && pool.pool_descriptor.pool_id != util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID
+               && pool.options.max_thread_count > pool.pool_descriptor.thread_count;
+    }
+
+    std::vector<std::unique_ptr<std::thread>> TaskScheduler::grow_pool(const std::shared_ptr<PoolQueue>& pool) {
+
+        // Only grow when every thread is busy and there is room to grow
+        std::vector<std::unique_ptr<std::thread>> retired_threads;
+        if (!started.load() || !running.load() || pool->sleeping != 0 || pool->spinning.load() != 0
+            || pool->live_threads >= pool->options.max_thread_count) {
+            return retired_threads;
+        }
+
+        // Take out any threads that have retired, they are joined by the caller once it no longer holds the mutex
+        for (auto it = pool->threads.begin(); it != pool->threads.end();) {
+            auto retired = std::find(pool->retired.begin(), pool->retired.end(), (*it)->get_id());
+            if (retired != pool->retired.end()) {
+                retired_threads.push_back(std::move(*it));
+                pool->retired.erase(retired);
+                it = pool->threads.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        pool->threads.emplace_back(std::make_unique<std::thread>(&TaskScheduler::pool_func, this, pool, nullptr));
+        ++pool->live_threads;
+        return retired_threads;
+    }
+
     std::shared_ptr<TaskScheduler::PoolQueue> TaskScheduler::get_pool_queue(const util::ThreadPoolDescriptor& pool) {
         // If the pool does not exist, create it
         const std::lock_guard<std::mutex> pool_lock(pool_mutex);
         if (pool_queues.count(pool.pool_id) == 0) {
             // Create the pool
-            auto queue                = std::make_shared<PoolQueue>(pool);
+            auto queue =
+                std::make_shared<PoolQueue>(pool, pool.options != nullptr ? *pool.options : util::ThreadPoolOptions{});
             pool_queues[pool.pool_id] = queue;
 
             // If the scheduler has not yet started then don't start the threads for this pool yet
@@ -132,7 +396,7 @@ namespace threading {
         }
 
         // Run main thread tasks
-        pool_func(pool_queues.at(util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID));
+        pool_func(pool_queues.at(util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID), nullptr);
 
         /**
          * Once the main thread reaches this point it is because the powerplant, and by extension the scheduler, have
@@ -141,19 +405,27 @@ namespace threading {
 
         // Poke all of the threads to make sure they are awake and then wait for them to finish
         for (auto& pool : pool_queues) {
-            /* mutex scope */ {
-                const std::lock_guard<std::mutex> queue_lock(pool.second->mutex);
-                pool.second->condition.notify_all();
-            }
-            for (auto& thread : pool.second->threads) {
-                try {
-                    if (thread->joinable()) {
-                        thread->join();
-                    }
+            // An elastic pool can still be adding threads, so take them out under the lock until none are left
+            while (true) {
+                std::vector<std::unique_ptr<std::thread>> threads;
+                /* mutex scope */ {
+                    const std::lock_guard<std::mutex> queue_lock(pool.second->mutex);
+                    pool.second->condition.notify_all();
+                    std::swap(threads, pool.second->threads);
+                }
+                if (threads.empty()) {
+                    break;
                 }
-                // This gets thrown some time if between checking if joinable and joining
-                // the thread is no longer joinable
-                catch (const std::system_error&) {
+                for (auto& thread : threads) {
+                    try {
+                        if (thread->joinable()) {
+                            thread->join();
+                        }
+                    }
+                    // This gets thrown some time if between checking if joinable and joining
+                    // the thread is no longer joinable
+                    catch (const std::system_error&) {
+                    }
                 }
             }
         }
@@ -173,20 +445,18 @@ namespace threading {
                                const util::GroupDescriptor& group_descriptor,
                                const util::ThreadPoolDescriptor& pool_descriptor,
                                const bool& immediate,
-                               std::function<void()>&& func) {
+                               TaskFunction&& func) {
 
         // Move the arguments into a struct
-        Task task{id, priority, group_descriptor, pool_descriptor, std::move(func)};
+        submit(Task{id, priority, group_descriptor, pool_descriptor, std::move(func)}, immediate);
+    }
+
+    void TaskScheduler::submit(Task&& task, const bool& immediate) {
 
         // Immediate tasks are executed directly on the current thread if they can be
         // If something is blocking them from running right now they are added to the queue
         if (immediate) {
-            bool runnable = false;
-            /* mutex scope */ {
-                const std::lock_guard<std::mutex> group_lock(group_mutex);
-                runnable = is_runnable(task.group_descriptor);
-            }
-            if (runnable) {
+            if (is_runnable(task.group_descriptor)) {
                 run_task(std::move(task));
                 return;
             }
@@ -194,24 +464,231 @@ namespace threading {
 
         // We do not accept new tasks once we are shutdown
         if (running.load()) {
-            // Get the appropiate pool for this task
-            const std::shared_ptr<PoolQueue> pool = get_pool_queue(task.thread_pool_descriptor);
+            enqueue(&task, &task + 1);
+        }
+    }
+
+    void TaskScheduler::submit(std::vector<Task>&& tasks) {
 
-            // Find where to insert the new task to maintain task order
-            const std::lock_guard<std::mutex> queue_lock(pool->mutex);
-            auto& queue = pool->queue;
-            auto it     = std::lower_bound(queue.begin(), queue.end(), task);
-            queue.insert(it, std::move(task));
+        // We do not accept new tasks once we are shutdown
+        if (!running.load() || tasks.empty()) {
+            return;
+        }
 
-            // Notify a single thread that there is a new task
-            pool->condition.notify_one();
+        // Move the tasks for the first pool to the front so each pool only needs to be locked once. Batches only
+        // span a few pools and the queue orders the tasks anyway, so this is cheaper than sorting them
+        Task* first = tasks.data();
+        Task* end   = tasks.data() + tasks.size();
+        while (first != end) {
+            const NUClear::id_t pool_id = first->thread_pool_descriptor.pool_id;
+            Task* last                  = std::partition(first + 1, end, [&pool_id](const Task& task) {
+                return task.thread_pool_descriptor.pool_id == pool_id;
+            });
+            enqueue(first, last);
+            first = last;
         }
     }
 
-    TaskScheduler::Task TaskScheduler::get_task() {
+    uint64_t TaskScheduler::missed_deadlines() const {
+        return missed_deadline_count.load(std::memory_order_relaxed);
+    }
+
+    message::SchedulerStatistics TaskScheduler::statistics() const {
+
+        message::SchedulerStatistics stats;
+        stats.timestamp        = NUClear::clock::now();
+        stats.missed_deadlines = missed_deadlines();
+
+        // Copy the pools so that we don't hold the pool lock while we look at each of them
+        std::vector<std::shared_ptr<PoolQueue>> pools;
+        /* mutex scope */ {
+            const std::lock_guard<std::mutex> lock(pool_mutex);
+            for (const auto& pool : pool_queues) {
+                pools.push_back(pool.second);
+            }
+        }
+
+        for (const auto& pool : pools) {
+            message::SchedulerStatistics::Pool s;
+            s.pool_id = pool->pool_descriptor.pool_id;
+            /* mutex scope */ {
+                const std::lock_guard<std::mutex> lock(pool->mutex);
+                // The main thread is never started by the scheduler so it isn't counted as a live thread
+                s.threads     = s.pool_id == util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID ? 1 : pool->live_threads;
+                s.queue_depth = pool->queue.size();
+                for (const auto& local : pool->local_queues) {
+                    const std::lock_guard<std::mutex> local_lock(local->mutex);
+                    s.queue_depth += local->queue.size();
+                }
+            }
+            s.parked   = pool->parked.load(std::memory_order_relaxed);
+            s.sleeping = pool->sleeping.load(std::memory_order_relaxed);
+            s.spinning = pool->spinning.load(std::memory_order_relaxed);
+
+            uint64_t wait_time = 0;
+            for (const auto& c : pool->counters) {
+                s.tasks_submitted += c.submitted.load(std::memory_order_relaxed);
+                s.enqueues += c.enqueues.load(std::memory_order_relaxed);
+                s.tasks_run += c.run.load(std::memory_order_relaxed);
+                s.waits += c.waits.load(std::memory_order_relaxed);
+                wait_time += c.wait_time.load(std::memory_order_relaxed);
+                s.spins += c.spins.load(std::memory_order_relaxed);
+                s.spin_hits += c.spin_hits.load(std::memory_order_relaxed);
+                s.rescans += c.rescans.load(std::memory_order_relaxed);
+                s.parks += c.parks.load(std::memory_order_relaxed);
+                s.queue_lock_contended += c.queue_lock_contended.load(std::memory_order_relaxed);
+                s.group_lock_contended += c.group_lock_contended.load(std::memory_order_relaxed);
+            }
+            s.wait_time =
+                std::chrono::duration_cast<NUClear::clock::duration>(std::chrono::nanoseconds(int64_t(wait_time)));
+
+            stats.pools.push_back(s);
+        }
+
+        return stats;
+    }
 
-        // Wait at a high (but not realtime) priority to reduce latency for picking up a new task
-        update_current_thread_priority(1000);
+    void TaskScheduler::enqueue(Task* first, Task* last) {
+
+        // Tasks submitted from within their own pool don't need to look up the pool
+        const bool same_pool = current_queue != nullptr
+                               && (*current_queue)->pool_descriptor.pool_id == first->thread_pool_descriptor.pool_id;
+
+        // A single task from a thread of its own pool is run next by that thread while its cache still has the data
+        // Once a chain of these has run for long enough the new task goes into the queue so other tasks get a turn
+        if (same_pool && last - first == 1 && current_next_task != nullptr
+            && current_next_task->chain < NEXT_TASK_CHAIN_LIMIT) {
+            NextTask& next = *current_next_task;
+            if (!next.full) {
+                next.task = std::move(*first);
+                next.full = true;
+                counters(**current_queue).submitted.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            // The newest task takes the slot and the one it replaces is queued like any other task
+            std::swap(next.task, *first);
+        }
+
+        // Get the appropiate pool for these tasks
+        const std::shared_ptr<PoolQueue> pool =
+            same_pool ? *current_queue : get_pool_queue(first->thread_pool_descriptor);
+        const size_t count    = size_t(last - first);
+        PoolCounters& counter = counters(*pool);
+        counter.submitted.fetch_add(count, std::memory_order_relaxed);
+
+        // When work stealing, tasks from a thread in this pool go into that thread's own queue
+        if (same_pool && current_local_queue != nullptr) {
+            counter.enqueues.fetch_add(1, std::memory_order_relaxed);
+            /* mutex scope */ {
+                const auto local_lock = lock_counted(current_local_queue->mutex, &counter.queue_lock_contended);
+                auto& queue           = current_local_queue->queue;
+                for (Task* task = first; task != last; ++task) {
+                    queue.push(std::move(*task));
+                }
+                // This store must be visible to any thread that is about to sleep before we check for sleepers
+                current_local_queue->top_priority.store(queue.top_priority());
+            }
+
+            // Only wake threads to steal these tasks if there are some sleeping and none that are spinning
+            if (pool->sleeping.load() > 0 && pool->spinning.load() == 0) {
+                const std::lock_guard<std::mutex> queue_lock(pool->mutex);
+                wake(*pool, count);
+            }
+            return;
+        }
+
+        // Elastic pools need to know how long tasks have been waiting to decide if they should grow
+        const bool elastic = is_elastic(*pool);
+        if (elastic) {
+            const auto now = std::chrono::steady_clock::now();
+            for (Task* task = first; task != last; ++task) {
+                task->queued = now;
+            }
+        }
+
+        // Add the tasks to the queue, they will be ordered by their priority and id
+        counter.enqueues.fetch_add(1, std::memory_order_relaxed);
+        auto queue_lock = lock_counted(pool->mutex, &counter.queue_lock_contended);
+        auto& queue     = pool->queue;
+        for (Task* task = first; task != last; ++task) {
+            queue.push(std::move(*task));
+        }
+        pool->top_priority.store(queue.top_priority());
+
+        // Add a thread if the tasks are backing up
+        std::vector<std::unique_ptr<std::thread>> retired;
+        if (elastic && queue.size() >= pool->options.grow_queue_depth) {
+            retired = grow_pool(pool);
+        }
+
+        // Notify threads that there are new tasks, unless a spinning thread is about to see them anyway
+        if (pool->spinning.load() == 0) {
+            wake(*pool, count);
+        }
+
+        // Clean up threads that left the pool without making the other threads wait on the mutex for them
+        queue_lock.unlock();
+        for (auto& thread : retired) {
+            thread->join();
+        }
+    }
+
+    void TaskScheduler::wake(PoolQueue& pool, const size_t& count) {
+        // Wake one thread per task, but there is no point waking more threads than are sleeping
+        const size_t sleeping = pool.sleeping.load();
+        if (count > 1 && count >= sleeping) {
+            pool.condition.notify_all();
+        }
+        else {
+            for (size_t i = 0; i < std::max<size_t>(count, 1); ++i) {
+                pool.condition.notify_one();
+            }
+        }
+    }
+
+    bool TaskScheduler::spin(PoolQueue& pool) {
+
+        // Anything that is not the lowest int means that queue has a task in it
+        auto has_task = [&pool] {
+            bool found = pool.top_priority.load() != std::numeric_limits<int>::min();
+            for (const auto& local : pool.local_queues) {
+                found = found || local->top_priority.load() != std::numeric_limits<int>::min();
+            }
+            return found;
+        };
+
+        const auto& budget = pool.options.spin_duration;
+        const auto start   = std::chrono::steady_clock::now();
+
+        // This must be seen by anyone submitting before they decide whether to wake a sleeping thread
+        pool.spinning.fetch_add(1);
+        bool found = has_task();
+        while (!found && running.load()) {
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed >= budget) {
+                break;
+            }
+
+            // Busy wait for the first half of the budget, then start letting other threads have the cpu
+            if (elapsed < budget / 2) {
+                cpu_relax();
+            }
+            else {
+                std::this_thread::yield();
+            }
+            found = has_task();
+        }
+        pool.spinning.fetch_sub(1);
+
+        PoolCounters& counter = counters(pool);
+        counter.spins.fetch_add(1, std::memory_order_relaxed);
+        if (found) {
+            counter.spin_hits.fetch_add(1, std::memory_order_relaxed);
+        }
+        return found;
+    }
+
+    TaskScheduler::Task TaskScheduler::get_task() {
 
         if (current_queue == nullptr) {
             throw std::runtime_error("Only threads managed by the TaskScheduler can get tasks");
@@ -219,56 +696,279 @@ namespace threading {
 
         // Get the queue for this thread from its thread local storage
         const std::shared_ptr<PoolQueue> pool = *current_queue;
-        auto& queue                           = pool->queue;
-        auto& condition                       = pool->condition;
 
-        // Keep looking for tasks while the scheduler is still running, or while there are still tasks to process
-        std::unique_lock<std::mutex> lock(pool->mutex);
-        while (running.load() || !queue.empty()) {
-
-            // Only one thread can be checking group concurrency at a time otherwise the ordering might not be correct
-            /* mutex scope */ {
-                const std::lock_guard<std::mutex> group_lock(group_mutex);
+        // The task this thread submitted for itself runs next unless something more important is waiting
+        Task next;
+        if (take_next_task(*pool, next)) {
+            return next;
+        }
 
-                // Iterate over all the tasks in the current thread pool queue, looking for one that we can run
-                for (auto it = queue.begin(); it != queue.end(); ++it) {
+        // Work stealing pools have a different strategy for finding tasks
+        if (!pool->local_queues.empty()) {
+            return get_stolen_task(pool);
+        }
 
-                    // Check if we can run the task
-                    if (is_runnable(it->group_descriptor)) {
+        auto& queue           = pool->queue;
+        auto& condition       = pool->condition;
+        const bool elastic    = is_elastic(*pool);
+        PoolCounters& counter = counters(*pool);
 
-                        // Move the task out of the queue
-                        Task task = std::move(*it);
+        // Keep looking for tasks while the scheduler is still running, or while there are still tasks to process
+        std::unique_lock<std::mutex> lock = lock_counted(pool->mutex, &counter.queue_lock_contended);
+        while (running.load() || !queue.empty() || pool->parked.load() != 0) {
+
+            // Look for a task that we can run in the current thread pool queue
+            Task task;
+            if (take_runnable(*pool, queue, pool->top_priority, task)) {
+                // Submitters skip waking a thread while one is spinning, so pass the wakeup on if tasks are left
+                if (!queue.empty()) {
+                    condition.notify_one();
+                }
 
-                        // Erase the old position in the queue
-                        queue.erase(it);
+                // Add a thread if this task had to wait too long to start
+                if (elastic && task.queued != std::chrono::steady_clock::time_point()
+                    && std::chrono::steady_clock::now() - task.queued > pool->options.grow_wait_time) {
+                    auto retired = grow_pool(pool);
 
-                        // Return the task
-                        return task;
+                    // Clean up threads that left the pool without making the other threads wait on the mutex for them
+                    lock.unlock();
+                    for (auto& thread : retired) {
+                        thread->join();
                     }
                 }
+                return task;
+            }
+            counter.rescans.fetch_add(1, std::memory_order_relaxed);
+
+            // If pool concurrency is greater than group concurrency some threads can be left with nothing to do.
+            // Since running is false there will likely never be anything new to do and we are shutting down anyway.
+            // So if we can't find a task to run we should just quit, unless a task from this pool is waiting on its
+            // group in which case it will be put back in the queue when a slot in the group is released.
+            if (!running.load() && pool->parked.load() == 0) {
+                condition.notify_all();
+                throw ShutdownThreadException();
+            }
 
-                // If pool concurrency is greater than group concurrency some threads can be left with nothing to do.
-                // Since running is false there will likely never be anything new to do and we are shutting down anyway.
-                // So if we can't find a task to run we should just quit.
-                if (!running.load()) {
-                    condition.notify_all();
-                    throw ShutdownThreadException();
+            // Look for a new task for a while before sleeping as one will often arrive soon. This is done at the
+            // priority of the last task so a spinning thread doesn't keep the thread that will give it work off the cpu
+            if (running.load() && pool->options.spin_duration.count() > 0) {
+                lock.unlock();
+                const bool found = spin(*pool);
+                lock.lock();
+
+                // A task may have been submitted after we stopped spinning but before we took the lock
+                if (found || !queue.empty()) {
+                    continue;
                 }
             }
 
-            // Wait for something to happen!
-            // We don't have a condition on this lock as the check would be this doing this loop again to see if there
-            // are any tasks we can execute (checking all the groups) so therefore we already did the entry predicate.
-            // Putting a condition on this would stop spurious wakeups of which the cost would be equal to the loop.
-            condition.wait(lock);  // NOSONAR
+            // Sleep at a high priority to reduce latency for picking up a new task, when a task was ready straight away
+            // the thread goes directly to that task's priority instead
+            update_current_thread_priority(1000);
+
+            // Threads an elastic pool added leave once they have been idle for long enough
+            ++pool->sleeping;
+            counter.waits.fetch_add(1, std::memory_order_relaxed);
+            const auto sleep_start = std::chrono::steady_clock::now();
+            if (elastic && running.load() && pool->live_threads > pool->pool_descriptor.thread_count) {
+                const auto status = condition.wait_for(lock, pool->options.idle_timeout);
+                add_wait_time(counter.wait_time, sleep_start);
+                const bool timeout = status == std::cv_status::timeout;
+                if (timeout && queue.empty() && pool->live_threads > pool->pool_descriptor.thread_count) {
+                    --pool->sleeping;
+                    --pool->live_threads;
+                    pool->retired.push_back(std::this_thread::get_id());
+                    throw RetireThreadException();
+                }
+            }
+            else {
+                // Wait for something to happen!
+                // We don't have a condition on this lock as the check would be this doing this loop again to see if
+                // there are any tasks we can execute (checking all the groups) so therefore we already did the entry
+                // predicate. Putting a condition on this would stop spurious wakeups of which the cost would be equal
+                // to the loop.
+                condition.wait(lock);  // NOSONAR
+                add_wait_time(counter.wait_time, sleep_start);
+            }
+            --pool->sleeping;
         }
 
         // If we get out here then we are finished running.
         throw ShutdownThreadException();
     }
 
+    bool TaskScheduler::take_local_task(PoolQueue& pool, Task& task, const bool& include_shared) {
+
+        auto take = [this, &pool, &task](std::mutex& mutex,
+                                         util::RunQueue<Task>& queue,
+                                         std::atomic<int>& top_priority) {
+            const auto lock = lock_counted(mutex, &counters(pool).queue_lock_contended);
+            return take_runnable(pool, queue, top_priority, task);
+        };
+
+        LocalQueue* own         = current_local_queue;
+        const int empty         = std::numeric_limits<int>::min();
+        const int own_priority  = own != nullptr ? own->top_priority.load() : empty;
+        const int pool_priority = include_shared ? pool.top_priority.load() : empty;
+
+        // Find the other thread that is advertising the highest priority task
+        LocalQueue* victim  = nullptr;
+        int victim_priority = empty;
+        for (const auto& local : pool.local_queues) {
+            const int priority = local->top_priority.load();
+            if (local.get() != own && priority > victim_priority) {
+                victim          = local.get();
+                victim_priority = priority;
+            }
+        }
+
+        // Look in whichever queue has the highest priority task first, preferring our own queue then the shared queue
+        const bool own_first =
+            own_priority != empty && own_priority >= pool_priority && own_priority >= victim_priority;
+        const bool pool_first = !own_first && pool_priority != empty && pool_priority >= victim_priority;
+        if (own_first && take(own->mutex, own->queue, own->top_priority)) {
+            return true;
+        }
+        if (pool_first && take(pool.mutex, pool.queue, pool.top_priority)) {
+            return true;
+        }
+        if (!own_first && !pool_first && victim != nullptr
+            && take(victim->mutex, victim->queue, victim->top_priority)) {
+            return true;
+        }
+
+        // That queue may have been emptied by another thread or only held tasks waiting on their group so try the rest
+        if (!own_first && own != nullptr && take(own->mutex, own->queue, own->top_priority)) {
+            return true;
+        }
+        if (!pool_first && include_shared && take(pool.mutex, pool.queue, pool.top_priority)) {
+            return true;
+        }
+        for (const auto& local : pool.local_queues) {
+            if (local.get() != own && (local.get() != victim || own_first || pool_first)
+                && local->top_priority.load() != empty && take(local->mutex, local->queue, local->top_priority)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool TaskScheduler::take_next_task(PoolQueue& pool, Task& task) {
+
+        NextTask* next = current_next_task;
+        if (next == nullptr || !next->full) {
+            // A task came from the queue so the next chain can start again
+            if (next != nullptr) {
+                next->chain = 0;
+            }
+            return false;
+        }
+        Task candidate = std::move(next->task);
+        next->full     = false;
+
+        // In an earliest deadline first pool any task with a deadline is advertised as the highest priority, so when
+        // the slot's task also has a deadline the queue decides which of them is first
+        const auto& policy      = pool.options.scheduling_policy;
+        const bool edf          = policy == util::SchedulingPolicy::EARLIEST_DEADLINE_FIRST;
+        const bool has_deadline = candidate.deadline != NUClear::clock::time_point::max();
+        const int rank          = edf && has_deadline ? std::numeric_limits<int>::max() : candidate.priority;
+        const int waiting       = std::max(pool.top_priority.load(),
+                                           current_local_queue != nullptr ? current_local_queue->top_priority.load()
+                                                                          : std::numeric_limits<int>::min());
+
+        // A task that is at least as important is waiting, so to keep tasks of the same priority in order the slot's
+        // task takes its place in the queue with everything else
+        if (waiting >= rank) {
+            next->chain = 0;
+            if (current_local_queue != nullptr) {
+                const std::lock_guard<std::mutex> local_lock(current_local_queue->mutex);
+                current_local_queue->queue.push(std::move(candidate));
+                current_local_queue->top_priority.store(current_local_queue->queue.top_priority());
+            }
+            else {
+                const std::lock_guard<std::mutex> queue_lock(pool.mutex);
+                pool.queue.push(std::move(candidate));
+                pool.top_priority.store(pool.queue.top_priority());
+            }
+            return false;
+        }
+
+        // Like any other task it may have to wait for a slot in its group
+        if (candidate.group_reserved || is_runnable(candidate.group_descriptor) || !park(pool, candidate)) {
+            ++next->chain;
+            task = std::move(candidate);
+            return true;
+        }
+        next->chain = 0;
+        return false;
+    }
+
+    TaskScheduler::Task TaskScheduler::get_stolen_task(const std::shared_ptr<PoolQueue>& pool) {
+
+        Task task;
+        PoolCounters& counter = counters(*pool);
+        while (true) {
+
+            // Look in our own queue, the shared queue and the other threads' queues for the best task
+            if (take_local_task(*pool, task, true)) {
+                // Submitters to the shared queue skip waking a thread while one is spinning, so pass the wakeup on
+                if (pool->sleeping.load() > 0 && pool->top_priority.load() != std::numeric_limits<int>::min()) {
+                    const std::lock_guard<std::mutex> lock(pool->mutex);
+                    pool->condition.notify_one();
+                }
+                return task;
+            }
+            counter.rescans.fetch_add(1, std::memory_order_relaxed);
+
+            // Look for a new task for a while before sleeping as one will often arrive soon. This is done at the
+            // priority of the last task so a spinning thread doesn't keep the thread that will give it work off the cpu
+            if (running.load() && pool->options.spin_duration.count() > 0 && spin(*pool)) {
+                continue;
+            }
+
+            // Sleep at a high priority to reduce latency for picking up a new task, when a task was ready straight away
+            // the thread goes directly to that task's priority instead
+            update_current_thread_priority(1000);
+
+            // Lock the pool and mark ourselves as sleeping before the final check so any new task will wake us
+            std::unique_lock<std::mutex> lock = lock_counted(pool->mutex, &counter.queue_lock_contended);
+            pool->sleeping.fetch_add(1);
+            if (take_runnable(*pool, pool->queue, pool->top_priority, task) || take_local_task(*pool, task, false)) {
+                pool->sleeping.fetch_sub(1);
+                return task;
+            }
+
+            // Nothing new will arrive once we are shutting down, so when every queue is empty this thread is finished
+            // Tasks that are waiting on their group will be put back in the queue by the thread that releases the group
+            if (!running.load()) {
+                bool empty = pool->queue.empty();
+                for (const auto& local : pool->local_queues) {
+                    const std::lock_guard<std::mutex> local_lock(local->mutex);
+                    empty = empty && local->queue.empty();
+                }
+                if (empty && pool->parked.load() == 0) {
+                    pool->sleeping.fetch_sub(1);
+                    pool->condition.notify_all();
+                    throw ShutdownThreadException();
+                }
+            }
+
+            // Wait for a new task to be submitted to the pool
+            counter.waits.fetch_add(1, std::memory_order_relaxed);
+            const auto sleep_start = std::chrono::steady_clock::now();
+            pool->condition.wait(lock);  // NOSONAR
+            add_wait_time(counter.wait_time, sleep_start);
+            pool->sleeping.fetch_sub(1);
+        }
+    }
+
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
     ATTRIBUTE_TLS std::shared_ptr<TaskScheduler::PoolQueue>* TaskScheduler::current_queue = nullptr;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    ATTRIBUTE_TLS TaskScheduler::LocalQueue* TaskScheduler::current_local_queue = nullptr;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    ATTRIBUTE_TLS TaskScheduler::NextTask* TaskScheduler::current_next_task = nullptr;
 
 }  // namespace threading
 }  // namespace NUClear
@@ -23,17 +23,26 @@
 #ifndef NUCLEAR_THREADING_TASKSCHEDULER_HPP
 #define NUCLEAR_THREADING_TASKSCHEDULER_HPP
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
 
+#include "../Configuration.hpp"
+#include "../clock.hpp"
 #include "../id.hpp"
+#include "../message/SchedulerStatistics.hpp"
 #include "../util/GroupDescriptor.hpp"
+#include "../util/InlineFunction.hpp"
+#include "../util/RunQueue.hpp"
 #include "../util/ThreadPoolDescriptor.hpp"
 #include "../util/platform.hpp"
 
@@ -81,6 +90,12 @@ namespace threading {
      *  @code Single @endcode
      *  If single is encountered while processing the function, and a Task object for this Reaction is already
      * running in a thread, or waiting in the Queue, then this task is ignored and dropped from the system.
+     *
+     *  @em Work Stealing
+     *  When Configuration::work_stealing is set, each thread in a pool has its own task queue. Tasks that are submitted
+     *  from a thread in the same pool are placed in that thread's queue, while tasks from outside the pool are placed
+     *  in the pool's shared queue. Threads look first at whichever queue is advertising the highest priority task and
+     *  steal from the other threads in the pool when they have nothing else to do.
      */
     class TaskScheduler {
     private:
@@ -89,6 +104,15 @@ namespace threading {
          */
         class ShutdownThreadException : public std::exception {};
 
+        /**
+         * @brief Exception thrown when a thread that an elastic pool added has been idle and should leave the pool.
+         */
+        class RetireThreadException : public std::exception {};
+
+    public:
+        /// @brief The type of the functions that tasks run, small functions are stored in the task without allocating
+        using TaskFunction = util::InlineFunction<void()>;
+
         /**
          * @brief A struct which contains all the information about an individual task
          */
@@ -102,7 +126,13 @@ namespace threading {
             /// @brief The thread pool descriptor for this task
             util::ThreadPoolDescriptor thread_pool_descriptor;
             /// @brief The callback to be executed
-            std::function<void()> run;
+            TaskFunction run;
+            /// @brief The time this task should start by, or the maximum time point if it has no deadline
+            NUClear::clock::time_point deadline{NUClear::clock::time_point::max()};
+            /// @brief If this task has already been given a slot in its group when it was released from waiting
+            bool group_reserved{false};
+            /// @brief When this task was added to the queue of an elastic pool, used to decide if the pool should grow
+            std::chrono::steady_clock::time_point queued{};
 
             /**
              * @brief Compare tasks based on their priority
@@ -115,28 +145,142 @@ namespace threading {
             }
         };
 
+    private:
+        /**
+         * @brief Counters for how a thread pool is being used.
+         *
+         * @details
+         *  Each pool has several of these and each thread adds to just one of them, so threads in the same pool are
+         *  not all writing to the same cache line. They are summed when the statistics are read.
+         */
+        struct PoolCounters {
+            /// @brief The number of tasks that have been queued in the pool
+            std::atomic<uint64_t> submitted{0};
+            /// @brief The number of times tasks were added to the pool's queues, taking a queue lock each time
+            std::atomic<uint64_t> enqueues{0};
+            /// @brief The number of tasks the pool's threads have run
+            std::atomic<uint64_t> run{0};
+            /// @brief The number of times a thread went to sleep waiting for a task
+            std::atomic<uint64_t> waits{0};
+            /// @brief The total time in nanoseconds that threads have spent asleep waiting for a task
+            std::atomic<uint64_t> wait_time{0};
+            /// @brief The number of times a thread spun looking for a task before going to sleep
+            std::atomic<uint64_t> spins{0};
+            /// @brief The number of times a spinning thread found a task
+            std::atomic<uint64_t> spin_hits{0};
+            /// @brief The number of times a thread looked in the queues and found nothing it could run
+            std::atomic<uint64_t> rescans{0};
+            /// @brief The number of tasks that were moved to the wait list of their group
+            std::atomic<uint64_t> parks{0};
+            /// @brief The number of times a queue lock was already held when it was wanted
+            std::atomic<uint64_t> queue_lock_contended{0};
+            /// @brief The number of times a group lock was already held when it was wanted
+            std::atomic<uint64_t> group_lock_contended{0};
+        };
+
+        /// @brief The number of sets of counters each pool has
+        static constexpr size_t COUNTER_SHARDS = 8;
+
+        /**
+         * @brief A queue of tasks owned by a single thread in a work stealing thread pool
+         */
+        struct LocalQueue {
+            explicit LocalQueue(const bool& earliest_deadline_first) : queue(earliest_deadline_first) {}
+            /// @brief The queue of tasks for this thread
+            util::RunQueue<Task> queue;
+            /// @brief The mutex which protects the queue
+            std::mutex mutex;
+            /// @brief The priority of the task at the front of the queue, used to choose which queue to look in first
+            std::atomic<int> top_priority{std::numeric_limits<int>::min()};
+        };
+
         /**
          * @brief A struct which contains all the information about an individual thread pool
          */
         struct PoolQueue {
-            explicit PoolQueue(const util::ThreadPoolDescriptor& pool_descriptor) : pool_descriptor(pool_descriptor) {}
+            PoolQueue(const util::ThreadPoolDescriptor& pool_descriptor, const util::ThreadPoolOptions& options)
+                : pool_descriptor(pool_descriptor)
+                , options(options)
+                , queue(options.scheduling_policy == util::SchedulingPolicy::EARLIEST_DEADLINE_FIRST) {}
             /// @brief The descriptor for this thread pool
             const util::ThreadPoolDescriptor pool_descriptor;
+            /// @brief The settings for this thread pool, copied from the descriptor when the pool was created
+            const util::ThreadPoolOptions options;
             /// @brief The threads which are running in this thread pool
             std::vector<std::unique_ptr<std::thread>> threads;
             /// @brief The queue of tasks for this specific thread pool
-            std::vector<Task> queue;
+            util::RunQueue<Task> queue;
             /// @brief The mutex which protects the queue
             std::mutex mutex;
             /// @brief The condition variable which threads wait on if they can't get a task
             std::condition_variable condition;
+            /// @brief The priority of the task at the front of the shared queue
+            std::atomic<int> top_priority{std::numeric_limits<int>::min()};
+            /// @brief The per thread queues when work stealing, these are created before the threads are started
+            std::vector<std::unique_ptr<LocalQueue>> local_queues;
+            /// @brief The number of threads that are waiting on the condition variable for a task
+            std::atomic<size_t> sleeping{0};
+            /// @brief The number of tasks from this pool that are waiting for a slot in their group
+            std::atomic<size_t> parked{0};
+            /// @brief The number of threads that are spinning looking for a task before they go to sleep
+            std::atomic<size_t> spinning{0};
+            /// @brief The number of threads that are running in this pool, protected by the mutex
+            size_t live_threads{0};
+            /// @brief Threads that have left an elastic pool and need to be joined, protected by the mutex
+            std::vector<std::thread::id> retired;
+            /// @brief The counters for this pool, each thread uses the one for its shard
+            std::array<PoolCounters, COUNTER_SHARDS> counters{};
+        };
+
+        /**
+         * @brief The task a thread will run next, which it submitted itself so the data it needs is already in cache
+         */
+        struct NextTask {
+            /// @brief The task to run next, only valid when full is true
+            Task task;
+            /// @brief If there is a task waiting in this slot
+            bool full{false};
+            /// @brief How many tasks in a row this thread has run from its slot rather than the queue
+            size_t chain{0};
+        };
+
+        /// @brief The most tasks in a row a thread will run from its next task slot before it uses the queue again.
+        /// Other threads can't see a task in the slot, so this bounds how long a chain can keep work away from them
+        static constexpr size_t NEXT_TASK_CHAIN_LIMIT = 16;
+
+        /**
+         * @brief The state of a group of tasks which has a limit on how many of its tasks can run at once
+         */
+        struct GroupState {
+            /// @brief The number of tasks in this group that are running or have been given a slot to run
+            std::atomic<size_t> active{0};
+            /// @brief The number of tasks in the wait list, so threads can check it without taking the lock
+            std::atomic<size_t> waiting_count{0};
+            /// @brief The mutex which protects the wait list
+            std::mutex mutex;
+            /// @brief The tasks which could not run because the group was full, in the order they will be released
+            util::RunQueue<Task> waiting;
         };
 
+        /// @brief The number of groups in each chunk of the group table
+        static constexpr size_t GROUP_CHUNK_SIZE = 256;
+        /// @brief The number of chunks in the group table, groups with larger ids are kept in a map behind a lock
+        static constexpr size_t GROUP_CHUNK_COUNT = 4096;
+
     public:
         /**
          * @brief Constructs a new TaskScheduler instance, and builds the nullptr sync queue.
+         *
+         * @param config the configuration for the default thread pool and the scheduling mode
          */
-        explicit TaskScheduler(const size_t& default_thread_count);
+        explicit TaskScheduler(const Configuration& config);
+        ~TaskScheduler();
+
+        // The group table is owned by the scheduler so it can not be copied or moved
+        TaskScheduler(const TaskScheduler&)            = delete;
+        TaskScheduler(TaskScheduler&&)                 = delete;
+        TaskScheduler& operator=(const TaskScheduler&) = delete;
+        TaskScheduler& operator=(TaskScheduler&&)      = delete;
 
         /**
          * @brief Starts the scheduler, and begins executing tasks.
@@ -174,9 +318,84 @@ namespace threading {
                     const util::GroupDescriptor& group,
                     const util::ThreadPoolDescriptor& pool,
                     const bool& immediate,
-                    std::function<void()>&& func);
+                    TaskFunction&& func);
+
+        /**
+         * @brief Submit a new task to be executed to the Scheduler.
+         *
+         * @param task      the task to execute
+         * @param immediate if this task should run immediately in the current thread, if it can't it is queued
+         */
+        void submit(Task&& task, const bool& immediate);
+
+        /**
+         * @brief Submit a batch of new tasks to be executed to the Scheduler.
+         *
+         * @details
+         *  The tasks are added to the queue for each of their pools while holding that pool's lock once, and enough
+         *  sleeping threads are woken to run them. Tasks in a batch are never run immediately.
+         *
+         * @param tasks the tasks to submit
+         */
+        void submit(std::vector<Task>&& tasks);
+
+        /**
+         * @brief Gets how many tasks with a deadline have started after it
+         *
+         * @return the number of missed deadlines since the scheduler was created
+         */
+        uint64_t missed_deadlines() const;
+
+        /**
+         * @brief Takes a snapshot of the state of each thread pool and the totals of its counters
+         *
+         * @details This briefly takes the lock of each queue to count the tasks in it
+         *
+         * @return the statistics for every thread pool
+         */
+        message::SchedulerStatistics statistics() const;
 
     private:
+        /**
+         * @brief Gets the counters the current thread uses in a pool
+         *
+         * @param pool the pool to get the counters for
+         *
+         * @return the counters for the current thread's shard
+         */
+        static PoolCounters& counters(PoolQueue& pool);
+
+        /**
+         * @brief Adds tasks which all belong to the same pool to that pool's queue and wakes threads to run them
+         *
+         * @param first the first task to add
+         * @param last  one past the last task to add
+         */
+        void enqueue(Task* first, Task* last);
+
+        /**
+         * @brief Wakes enough sleeping threads in a pool to run some new tasks
+         *
+         * @details The caller must hold the pool's mutex
+         *
+         * @param pool  the pool to wake threads in
+         * @param count the number of new tasks
+         */
+        static void wake(PoolQueue& pool, const size_t& count);
+
+        /**
+         * @brief Waits for a task to arrive in the pool without sleeping, for up to the pool's spin duration.
+         *
+         * @details
+         *  While a thread is spinning, submitters do not wake sleeping threads as the spinning thread will find the
+         *  new task. The thread busy waits for the first half of the duration and yields for the rest.
+         *
+         * @param pool the pool to watch for new tasks
+         *
+         * @return true if a task arrived in the pool before the spin duration ran out
+         */
+        bool spin(PoolQueue& pool);
+
         /**
          * @brief Get a task object to be executed by a thread.
          *
@@ -189,6 +408,109 @@ namespace threading {
          */
         Task get_task();
 
+        /**
+         * @brief Get a task object to be executed by a thread in a work stealing thread pool.
+         *
+         * @details
+         *  This behaves the same as get_task, however it will look in the current thread's local queue, the pool's
+         *  shared queue and the other threads' local queues for a task to execute.
+         *
+         * @param pool  the pool that the current thread belongs to
+         *
+         * @return the task which has been given to be executed
+         */
+        Task get_stolen_task(const std::shared_ptr<PoolQueue>& pool);
+
+        /**
+         * @brief Looks in the queues of a work stealing pool for a task that can be run.
+         *
+         * @details
+         *  The queue that is advertising the highest priority task is checked first, preferring the current thread's
+         *  queue, then the shared queue and then the queues of the other threads in the pool. If that task is blocked
+         *  by its group the remaining queues are checked.
+         *
+         * @param pool              the pool to look in
+         * @param task              the task that was found
+         * @param include_shared    if the shared queue should be checked, the caller must not hold its lock if so
+         *
+         * @return true if a task was found and moved into task
+         */
+        bool take_local_task(PoolQueue& pool, Task& task, const bool& include_shared);
+
+        /**
+         * @brief Takes the task from the current thread's next task slot if it should run before the queued tasks
+         *
+         * @details
+         *  If a task with the same or a higher priority (or with a deadline in an earliest deadline first pool) is
+         *  waiting in the pool the slot's task is moved to the queue instead so the tasks run in their normal order.
+         *
+         * @param pool the pool the current thread belongs to
+         * @param task the task that was taken from the slot
+         *
+         * @return true if a task was taken from the slot and moved into task
+         */
+        bool take_next_task(PoolQueue& pool, Task& task);
+
+        /**
+         * @brief Takes the highest priority runnable task from a queue.
+         *
+         * @details
+         *  The lock for the queue must be held by the caller. Any tasks ahead of the runnable task whose group is full
+         *  are moved to the wait list for their group, so they are not looked at again until a slot is released.
+         *
+         * @param pool          the pool that the queue belongs to
+         * @param queue         the queue to take the task from
+         * @param top_priority  the priority hint for the queue that is updated if a task is removed
+         * @param task          the task that was found
+         *
+         * @return true if a task was found and moved into task
+         */
+        bool take_runnable(PoolQueue& pool, util::RunQueue<Task>& queue, std::atomic<int>& top_priority, Task& task);
+
+        /**
+         * @brief Moves a task whose group is full into the wait list for its group.
+         *
+         * @details
+         *  If a slot in the group was released before the task could be added to the wait list then the task takes
+         *  that slot instead and is not moved
+         *
+         * @param pool the pool that the task belongs to
+         * @param task the task to park
+         *
+         * @return true if the task was moved to the wait list, false if it now has a slot in its group and can run
+         */
+        bool park(PoolQueue& pool, Task& task);
+
+        /**
+         * @brief Gets the state for a group from the group table, creating the chunk it lives in if needed
+         *
+         * @details Groups with ids past the end of the table are looked up in a map while holding a lock instead
+         *
+         * @param group_id the id of the group
+         *
+         * @return the state of the group
+         */
+        GroupState& get_group(const NUClear::id_t& group_id);
+
+        /**
+         * @brief Takes a slot in a group if it has one free
+         *
+         * @param state         the state of the group
+         * @param thread_count  the number of tasks that can run at once in the group
+         *
+         * @return true if a slot was taken
+         */
+        static bool acquire_slot(GroupState& state, const size_t& thread_count);
+
+        /**
+         * @brief Checks if there are any tasks left in the pool, in its queues or waiting on their group.
+         *
+         * @param pool the pool to check
+         *
+         * @return true if there are no tasks in the pool
+         */
+        static bool pool_empty(PoolQueue& pool);
+
         /**
          * @brief Gets a pool queue for the given thread pool descriptor or creates one if it does not exist
          *
@@ -203,20 +525,43 @@ namespace threading {
          *
          * @details This function will repeatedly query the task queue for new a task to run and then execute that task
          *
-         * @param pool the thread pool to run from and the task queue to get tasks from
+         * @param pool  the thread pool to run from and the task queue to get tasks from
+         * @param local the local queue for this thread when work stealing, or nullptr
          */
-        void pool_func(std::shared_ptr<PoolQueue> pool);
+        void pool_func(std::shared_ptr<PoolQueue> pool, LocalQueue* local);
 
         /**
          * @brief Start all threads for the given thread pool
          */
         void start_threads(const std::shared_ptr<PoolQueue>& pool);
 
+        /**
+         * @brief Checks if a pool can change how many threads it has
+         *
+         * @param pool the pool to check
+         *
+         * @return true if the pool is elastic
+         */
+        bool is_elastic(const PoolQueue& pool) const;
+
+        /**
+         * @brief Adds a thread to an elastic pool if all its threads are busy and it has room for another
+         *
+         * @details The caller must hold the pool's mutex. Threads that have retired from the pool are handed back so
+         *          the caller can join them once it has released the mutex
+         *
+         * @param pool the pool to add a thread to
+         *
+         * @return the retired threads which the caller must join
+         */
+        std::vector<std::unique_ptr<std::thread>> grow_pool(const std::shared_ptr<PoolQueue>& pool);
+
         /**
          * @brief Execute the given task
          *
-         * @details After execution of the task has completed the number of active tasks in the tasks' group is
-         * decremented
+         * @details
+         *  After execution of the task has completed the number of active tasks in the tasks' group is decremented.
+         *  If there are tasks waiting on the group the best of them is given the free slot and put back in its pool
          *
          * @param task  the task to execute
          */
@@ -225,8 +570,9 @@ namespace threading {
         /**
          * @brief Determines if the given task is able to be executed
          *
-         * @details If the current thread is able to be executed the number of active tasks in the tasks' groups is
-         * incremented
+         * @details
+         *  If the current thread is able to be executed the number of active tasks in the tasks' groups is
+         *  incremented. A new task will not take a slot while there are tasks waiting on the group
          *
          * @param group the group descriptor for the task
          *
@@ -235,25 +581,41 @@ namespace threading {
          */
         bool is_runnable(const util::GroupDescriptor& group);
 
+        /// @brief if the thread pools are using per thread queues and work stealing
+        const bool work_stealing;
+        /// @brief the settings for the default thread pool which come from the configuration
+        const util::ThreadPoolOptions default_pool_options;
+
         /// @brief if the scheduler is running, and accepting new tasks. If this is false and a new, non-immediate, task
         /// is submitted it will be ignored
         std::atomic<bool> running{true};
         /// @brief if the scheduler has been started. This is set to true after a call to start is made. Once this is
         /// set to true all threads will begin executing tasks from the tasks queue
         std::atomic<bool> started{false};
+        /// @brief the number of tasks that started after their deadline
+        std::atomic<uint64_t> missed_deadline_count{0};
 
-        /// @brief A map of group ids to the number of active tasks currently running in that group
-        std::map<NUClear::id_t, size_t> groups{};
-        /// @brief mutex for the group map
-        std::mutex group_mutex;
+        /// @brief A table of groups indexed by their id, split into chunks which are created when first used so that
+        /// looking up a group never needs a lock
+        std::array<std::atomic<GroupState*>, GROUP_CHUNK_COUNT> group_chunks{};
+        /// @brief The groups with ids too large for the group table
+        std::map<NUClear::id_t, GroupState> overflow_groups{};
+        /// @brief A mutex for when we are looking up or adding to the overflow_groups map
+        std::mutex overflow_groups_mutex;
 
         /// @brief A map of pool descriptor ids to pool descriptors
         std::map<NUClear::id_t, std::shared_ptr<PoolQueue>> pool_queues{};
         /// @brief a mutex for when we are modifying the pool_queues map
-        std::mutex pool_mutex;
+        mutable std::mutex pool_mutex;
         /// @brief a pointer to the pool_queue for the current thread so it does not have to access via the map
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
         static ATTRIBUTE_TLS std::shared_ptr<PoolQueue>* current_queue;
+        /// @brief a pointer to the local queue for the current thread when work stealing
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        static ATTRIBUTE_TLS LocalQueue* current_local_queue;
+        /// @brief a pointer to the next task slot for the current thread
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        static ATTRIBUTE_TLS NextTask* current_next_task;
     };
 
 }  // namespace threading
@@ -0,0 +1,248 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "tsc_clock.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #include <cpuid.h>
+    #include <x86intrin.h>
+    #define NUCLEAR_HAS_TSC
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define NUCLEAR_HAS_TSC
+#endif
+
+namespace NUClear {
+
+namespace {
+
+    /// @brief How long the first calibration measures the rate of the timestamp counter for
+    constexpr std::chrono::milliseconds CALIBRATION_TIME(5);
+    /// @brief How often the clock is resynchronised with steady_clock
+    constexpr std::chrono::nanoseconds RESYNC_INTERVAL(std::chrono::seconds(1));
+
+    /// @brief Reads the timestamp counter
+    inline uint64_t read_tsc() {
+#ifdef NUCLEAR_HAS_TSC
+        return __rdtsc();
+#else
+        return 0;
+#endif  // NUCLEAR_HAS_TSC
+    }
+
+    /// @brief Checks if the cpu says its timestamp counter ticks at a constant rate in every power state
+    bool tsc_invariant() {
+#if defined(NUCLEAR_HAS_TSC) && defined(_MSC_VER)
+        int regs[4] = {0, 0, 0, 0};  // NOLINT(modernize-avoid-c-arrays)
+        __cpuid(regs, 0x80000000);
+        if (unsigned(regs[0]) < 0x80000007U) {
+            return false;
+        }
+        __cpuid(regs, 0x80000007);
+        return (unsigned(regs[3]) & (1U << 8)) != 0;
+#elif defined(NUCLEAR_HAS_TSC)
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007U || !__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+            return false;
+        }
+        return (edx & (1U << 8)) != 0;
+#else
+        return false;
+#endif
+    }
+
+    /// @brief Reads steady_clock in nanoseconds since its epoch
+    inline int64_t steady_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /**
+     * @brief Converts timestamp counter readings to nanoseconds since steady_clock's epoch.
+     *
+     * @details
+     *  The conversion is a line through a base point. Readers take a copy of it using a sequence lock so they never
+     *  block, while the thread that resynchronises it is chosen by whoever gets the mutex first.
+     */
+    class Calibration {
+    public:
+        Calibration() : invariant(tsc_invariant()) {
+            if (!invariant) {
+                return;
+            }
+
+            // Measure the rate of the counter over a short interval
+            const uint64_t start_tsc = read_tsc();
+            const int64_t start_ns   = steady_ns();
+            int64_t end_ns           = start_ns;
+            while (end_ns - start_ns < std::chrono::nanoseconds(CALIBRATION_TIME).count()) {
+                end_ns = steady_ns();
+            }
+            const uint64_t end_tsc = read_tsc();
+
+            const double scale = double(end_ns - start_ns) / double(end_tsc - start_tsc);
+            sync_tsc           = end_tsc;
+            sync_ns            = end_ns;
+            store(end_tsc, end_ns, scale, uint64_t(double(RESYNC_INTERVAL.count()) / scale));
+        }
+
+        int64_t now() {
+            if (!invariant) {
+                return steady_ns();
+            }
+
+            const uint64_t tsc = read_tsc();
+            uint64_t base_tsc  = 0;
+            int64_t base_ns    = 0;
+            double scale       = 0.0;
+            uint64_t resync    = 0;
+            load(base_tsc, base_ns, scale, resync);
+
+            // Just after a resync another core's counter can read slightly behind the base point. The clock is steady
+            // so rather than going back to before the base it stays at the base until the counter passes it
+            const uint64_t ticks = tsc - base_tsc;
+            if (ticks >= (uint64_t(1) << 63)) {
+                return base_ns;
+            }
+            const int64_t ns = base_ns + int64_t(double(ticks) * scale);
+            if (ticks >= resync) {
+                resynchronise();
+            }
+            return ns;
+        }
+
+        const bool invariant;
+
+    private:
+        /// @brief Takes a consistent copy of the conversion
+        void load(uint64_t& base_tsc, int64_t& base_ns, double& scale, uint64_t& resync) const {
+            uint64_t before = 0;
+            uint64_t after  = 0;
+            do {
+                before   = sequence.load(std::memory_order_acquire);
+                base_tsc = this->base_tsc.load(std::memory_order_relaxed);
+                base_ns  = this->base_ns.load(std::memory_order_relaxed);
+                scale    = this->scale.load(std::memory_order_relaxed);
+                resync   = this->resync_ticks.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                after = sequence.load(std::memory_order_relaxed);
+            } while (before != after || (before & 1) != 0);
+        }
+
+        /// @brief Replaces the conversion, only one thread may call this at a time
+        void store(const uint64_t& base_tsc, const int64_t& base_ns, const double& scale, const uint64_t& resync) {
+            sequence.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            this->base_tsc.store(base_tsc, std::memory_order_relaxed);
+            this->base_ns.store(base_ns, std::memory_order_relaxed);
+            this->scale.store(scale, std::memory_order_relaxed);
+            this->resync_ticks.store(resync, std::memory_order_relaxed);
+            sequence.fetch_add(1, std::memory_order_release);
+        }
+
+        /// @brief Measures the rate of the counter again and slews the clock towards steady_clock
+        void resynchronise() {
+            std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+            if (!lock.owns_lock()) {
+                return;
+            }
+
+            uint64_t base_tsc = 0;
+            int64_t base_ns   = 0;
+            double scale      = 0.0;
+            uint64_t resync   = 0;
+            load(base_tsc, base_ns, scale, resync);
+
+            // Another thread may have just done this
+            const uint64_t tsc = read_tsc();
+            const int64_t ns   = steady_ns();
+            if (tsc - base_tsc < resync || tsc <= sync_tsc) {
+                return;
+            }
+
+            // The rate over the whole time since the last resync is much more accurate than the first calibration
+            const double rate    = double(ns - sync_ns) / double(tsc - sync_tsc);
+            const double ticks   = double(RESYNC_INTERVAL.count()) / rate;
+            int64_t current      = base_ns + int64_t(double(tsc - base_tsc) * scale);
+            const int64_t behind = ns - current;
+
+            // If we have fallen far behind just jump forward, otherwise pick a rate that will meet steady_clock at the
+            // next resync. The clock never jumps backwards and never runs at less than half or more than double speed
+            double slewed = rate;
+            if (behind > RESYNC_INTERVAL.count()) {
+                current = ns;
+            }
+            else {
+                slewed = std::min(std::max((double(behind) + double(RESYNC_INTERVAL.count())) / ticks, rate * 0.5),
+                                  rate * 2.0);
+            }
+
+            sync_tsc = tsc;
+            sync_ns  = ns;
+            store(tsc, current, slewed, uint64_t(ticks));
+        }
+
+        /// @brief Incremented before and after each change to the conversion so readers can tell if it changed
+        std::atomic<uint64_t> sequence{0};
+        /// @brief The counter reading at the base point
+        std::atomic<uint64_t> base_tsc{0};
+        /// @brief The time in nanoseconds at the base point
+        std::atomic<int64_t> base_ns{0};
+        /// @brief The number of nanoseconds per tick of the counter
+        std::atomic<double> scale{0.0};
+        /// @brief How many ticks after the base point the clock should be resynchronised
+        std::atomic<uint64_t> resync_ticks{0};
+
+        /// @brief Chooses the thread that resynchronises the clock
+        std::mutex mutex;
+        /// @brief The counter reading when steady_clock was last read, protected by the mutex
+        uint64_t sync_tsc{0};
+        /// @brief The steady_clock reading when it was last read, protected by the mutex
+        int64_t sync_ns{0};
+    };
+
+    Calibration& calibration() {
+        static Calibration instance;
+        return instance;
+    }
+
+}  // namespace
+
+tsc_clock::time_point tsc_clock::now() noexcept {
+    return time_point(duration(calibration().now()));
+}
+
+bool tsc_clock::uses_tsc() noexcept {
+    return calibration().invariant;
+}
+
+}  // namespace NUClear
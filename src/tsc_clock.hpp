@@ -0,0 +1,70 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_TSC_CLOCK_HPP
+#define NUCLEAR_TSC_CLOCK_HPP
+
+#include <chrono>
+#include <cstdint>
+
+namespace NUClear {
+
+/**
+ * @brief A steady clock that reads the cpu's timestamp counter rather than asking the operating system for the time.
+ *
+ * @details
+ *  Reading the timestamp counter takes a few nanoseconds, so this is much cheaper than steady_clock for taking the
+ *  timestamps of every task. The rate of the counter is calibrated against steady_clock the first time the clock is
+ *  used and resynchronised about once a second. Rather than jumping, the clock speeds up or slows down slightly until
+ *  it has caught up to steady_clock, so it shares steady_clock's epoch and stays within a few microseconds of it.
+ *
+ *  The counter is only used on x86 cpus that report it as invariant, meaning it ticks at a constant rate that does
+ *  not change with power states. On any other cpu this clock just reads steady_clock.
+ *
+ *  To use this as the NUClear clock either enable the NUCLEAR_TSC_CLOCK cmake option or define NUCLEAR_CLOCK_TYPE as
+ *  NUClear::tsc_clock everywhere NUClear is included.
+ */
+struct tsc_clock {
+    using rep                       = int64_t;
+    using period                    = std::nano;
+    using duration                  = std::chrono::duration<rep, period>;
+    using time_point                = std::chrono::time_point<tsc_clock>;
+    static constexpr bool is_steady = true;
+
+    /**
+     * @brief Gets the current time
+     *
+     * @return the current time, measured from the same epoch as steady_clock
+     */
+    static time_point now() noexcept;
+
+    /**
+     * @brief Checks if this clock reads the timestamp counter
+     *
+     * @return true if the timestamp counter is invariant and is being used, false if this clock reads steady_clock
+     */
+    static bool uses_tsc() noexcept;
+};
+
+}  // namespace NUClear
+
+#endif  // NUCLEAR_TSC_CLOCK_HPP
@@ -31,6 +31,7 @@
 #include "../util/MergeTransient.hpp"
 #include "../util/TransientDataElements.hpp"
 #include "../util/apply.hpp"
+#include "../util/current_thread_cpu_usage.hpp"
 #include "../util/demangle.hpp"
 #include "../util/update_current_thread_priority.hpp"
 
@@ -103,27 +104,67 @@ namespace util {
             // We have to make a copy of the callback because the "this" variable can go out of scope
             auto c = callback;
             return GeneratedCallback(DSL::priority(r),
+                                     DSL::deadline(r),
                                      DSL::group(r),
                                      DSL::pool(r),
                                      [c, data](threading::ReactionTask& task) noexcept {
                                          // Update our thread's priority to the correct level
                                          update_current_thread_priority(task.priority);
 
-                                         // Record our start time
-                                         task.stats->started = clock::now();
+                                         // Record our start time if anyone is listening for our statistics
+                                         // or we are recording timings
+                                         const bool timed = task.stats != nullptr || task.timed;
+                                         const auto started =
+                                             timed ? clock::now() : clock::time_point(std::chrono::seconds(0));
+                                         if (task.stats != nullptr) {
+                                             task.stats->started = started;
+                                         }
+
+                                         // Sample the thread's cpu usage if this reaction is measuring it
+                                         const bool cpu = task.statistics_level == StatisticsLevel::CPU;
+                                         const util::ThreadCPUUsage cpu_start =
+                                             cpu ? util::current_thread_cpu_usage() : util::ThreadCPUUsage{};
 
                                          // We have to catch any exceptions
+                                         bool failed = false;
                                          try {
                                              // We call with only the relevant arguments to the passed function
                                              util::apply_relevant(c, std::move(data));
                                          }
                                          catch (...) {
                                              // Catch our exception if it happens
-                                             task.stats->exception = std::current_exception();
+                                             failed = true;
+                                             if (task.stats != nullptr) {
+                                                 task.stats->exception = std::current_exception();
+                                             }
+                                         }
+
+                                         // The cpu used by the callback, stats always exist at the CPU level
+                                         if (cpu) {
+                                             const util::ThreadCPUUsage cpu_end = util::current_thread_cpu_usage();
+                                             task.stats->cpu_time = cpu_end.cpu_time - cpu_start.cpu_time;
+                                             task.stats->voluntary_context_switches =
+                                                 cpu_end.voluntary_context_switches
+                                                 - cpu_start.voluntary_context_switches;
+                                             task.stats->involuntary_context_switches =
+                                                 cpu_end.involuntary_context_switches
+                                                 - cpu_start.involuntary_context_switches;
                                          }
 
                                          // Our finish time
-                                         task.stats->finished = clock::now();
+                                         if (timed) {
+                                             const auto finished = clock::now();
+                                             if (task.stats != nullptr) {
+                                                 task.stats->finished = finished;
+                                             }
+                                             if (task.timed) {
+                                                 threading::ReactionTimings::record(task.parent.id,
+                                                                                    task.parent.identifiers,
+                                                                                    started - task.emitted,
+                                                                                    finished - started,
+                                                                                    failed);
+                                             }
+                                         }
 
                                          // Run our postconditions
                                          DSL::postcondition(task);
@@ -131,8 +172,9 @@ namespace util {
                                          // Take one from our active tasks
                                          --task.parent.active_tasks;
 
-                                         // Emit our reaction statistics if it wouldn't cause a loop
-                                         if (task.emit_stats) {
+                                         // Emit our reaction statistics if we recorded them, tasks only record
+                                         // them when it wouldn't cause a loop
+                                         if (task.stats != nullptr) {
                                              PowerPlant::powerplant->emit_shared<dsl::word::emit::Direct>(task.stats);
                                          }
                                      });
@@ -0,0 +1,192 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_FREELIST_HPP
+#define NUCLEAR_UTIL_FREELIST_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+#include "platform.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief Recycles blocks of memory of one size so that objects which are created and destroyed often do not
+     *        need to go to the heap each time.
+     *
+     * @details
+     *  Each thread keeps its own list of free blocks so allocating and freeing is normally just a pointer swap. Since
+     *  objects are often created on one thread and destroyed on another, when a thread has too many free blocks it
+     *  gives a batch of them to a shared list, and a thread that has run out takes a batch back. The shared list only
+     *  keeps a limited number of batches, anything past that is returned to the heap.
+     *
+     * @tparam Size      the size of the blocks in bytes
+     * @tparam BatchSize the number of blocks that are moved between a thread and the shared list at a time
+     */
+    template <size_t Size, size_t BatchSize = 32>
+    class FreeList {
+    private:
+        /// @brief A free block, which is linked to the other blocks in its batch and to the next batch
+        struct Block {
+            Block* next;
+            Block* next_batch;
+        };
+        static_assert(Size >= sizeof(Block), "Blocks must be large enough to hold the free list links");
+
+        /// @brief The maximum number of batches that are kept in the shared list
+        static constexpr size_t MAX_SHARED_BATCHES = 64;
+
+        /// @brief Returns a linked list of blocks to the heap
+        static void release(Block* block) noexcept {
+            while (block != nullptr) {
+                Block* next = block->next;
+                ::operator delete(block);
+                block = next;
+            }
+        }
+
+        /// @brief The free blocks that are shared between threads, kept as batches of BatchSize blocks
+        struct Shared {
+            ~Shared() {
+                while (batches != nullptr) {
+                    Block* next = batches->next_batch;
+                    release(batches);
+                    batches = next;
+                }
+            }
+            std::mutex mutex;
+            Block* batches{nullptr};
+            size_t count{0};
+        };
+
+        /// @brief The free blocks that belong to a single thread
+        struct Local {
+            ~Local() {
+                release(head);
+                ended = true;
+            }
+            Block* head{nullptr};
+            size_t count{0};
+        };
+
+        static Shared& shared() {
+            static Shared s;
+            return s;
+        }
+
+        static Local& local() {
+            static thread_local Local l;
+            return l;
+        }
+
+        /// @brief Set when this thread's list has been destroyed as the thread exits, after which the heap is used
+        static ATTRIBUTE_TLS bool ended;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    public:
+        /**
+         * @brief Gets a block of memory, reusing a free block if there is one
+         *
+         * @param size the number of bytes needed, if this is not Size the memory comes from the heap
+         *
+         * @return the memory
+         */
+        static void* allocate(const size_t& size) {
+            if (size != Size || ended) {
+                return ::operator new(size);
+            }
+
+            Local& l = local();
+            if (l.head == nullptr) {
+                Shared& s = shared();
+                const std::lock_guard<std::mutex> lock(s.mutex);
+                if (s.batches != nullptr) {
+                    l.head    = s.batches;
+                    l.count   = BatchSize;
+                    s.batches = s.batches->next_batch;
+                    --s.count;
+                }
+            }
+            if (l.head == nullptr) {
+                return ::operator new(size);
+            }
+
+            Block* block = l.head;
+            l.head       = block->next;
+            --l.count;
+            return block;
+        }
+
+        /**
+         * @brief Gives a block of memory back to be reused
+         *
+         * @param ptr  the memory, which must have come from allocate
+         * @param size the number of bytes that were asked for when it was allocated
+         */
+        static void deallocate(void* ptr, const size_t& size) noexcept {
+            if (size != Size || ended) {
+                ::operator delete(ptr);
+                return;
+            }
+
+            Local& l     = local();
+            Block* block = static_cast<Block*>(ptr);
+            block->next  = l.head;
+            l.head       = block;
+            ++l.count;
+
+            // Once we have two batches worth give one away so the threads that create objects can reuse them
+            if (l.count == 2 * BatchSize) {
+                Block* batch = l.head;
+                Block* last  = batch;
+                for (size_t i = 1; i < BatchSize; ++i) {
+                    last = last->next;
+                }
+                l.head     = last->next;
+                l.count    = BatchSize;
+                last->next = nullptr;
+
+                Shared& s = shared();
+                std::unique_lock<std::mutex> lock(s.mutex);
+                if (s.count < MAX_SHARED_BATCHES) {
+                    batch->next_batch = s.batches;
+                    s.batches         = batch;
+                    ++s.count;
+                }
+                else {
+                    lock.unlock();
+                    release(batch);
+                }
+            }
+        }
+    };
+
+    template <size_t Size, size_t BatchSize>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    ATTRIBUTE_TLS bool FreeList<Size, BatchSize>::ended = false;
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_FREELIST_HPP
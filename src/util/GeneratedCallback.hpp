@@ -25,6 +25,7 @@
 
 #include <limits>
 
+#include "../clock.hpp"
 #include "../threading/ReactionTask.hpp"
 #include "GroupDescriptor.hpp"
 #include "ThreadPoolDescriptor.hpp"
@@ -38,12 +39,15 @@ namespace util {
     struct GeneratedCallback {
         GeneratedCallback() = default;
         GeneratedCallback(const int& priority,
+                          const clock::duration& deadline,
                           const GroupDescriptor& group,
                           const ThreadPoolDescriptor& pool,
                           threading::ReactionTask::TaskFunction callback)
-            : priority(priority), group(group), pool(pool), callback(std::move(callback)) {}
+            : priority(priority), deadline(deadline), group(group), pool(pool), callback(std::move(callback)) {}
         /// @brief the priority this task should run with
         int priority{0};
+        /// @brief how long after it is created this task should start by, or max if it has no deadline
+        clock::duration deadline{clock::duration::max()};
         /// @brief the descriptor for the group the task should run in
         GroupDescriptor group{0, std::numeric_limits<size_t>::max()};
         /// @brief the descriptor the thread pool and task queue that the should run in
@@ -0,0 +1,194 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_INLINEFUNCTION_HPP
+#define NUCLEAR_UTIL_INLINEFUNCTION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace NUClear {
+namespace util {
+
+    template <typename Signature, size_t Capacity = 48>
+    class InlineFunction;
+
+    /**
+     * @brief A move only function wrapper that stores small callables inside itself rather than on the heap.
+     *
+     * @details
+     *  Callables that fit in Capacity bytes, and can be moved without throwing, are stored inline so wrapping them does
+     *  not allocate. Larger callables are moved to the heap like std::function would. Since it is never copied the
+     *  callable can capture move only types such as std::unique_ptr.
+     *
+     * @tparam R        the return type of the function
+     * @tparam Args     the argument types of the function
+     * @tparam Capacity the number of bytes of inline storage
+     */
+    template <typename R, typename... Args, size_t Capacity>
+    class InlineFunction<R(Args...), Capacity> {
+    private:
+        /// @brief The operations for a particular type of callable
+        struct Operations {
+            /// @brief Calls the callable in the storage
+            R (*invoke)(void* storage, Args&&... args);
+            /// @brief Moves the callable from one storage to another and destroys the original
+            void (*move)(void* from, void* to) noexcept;
+            /// @brief Destroys the callable in the storage
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        /// @brief If a callable of type F is stored inline rather than on the heap
+        template <typename F>
+        using fits_inline = std::integral_constant<bool,
+                                                   sizeof(F) <= Capacity
+                                                       && alignof(std::max_align_t) % alignof(F) == 0
+                                                       && std::is_nothrow_move_constructible<F>::value>;
+
+        /// @brief Operations for callables stored in the inline storage
+        template <typename F>
+        static const Operations* inline_operations() {
+            static const Operations ops = {
+                [](void* storage, Args&&... args) -> R {
+                    return (*static_cast<F*>(storage))(std::forward<Args>(args)...);
+                },
+                [](void* from, void* to) noexcept {
+                    new (to) F(std::move(*static_cast<F*>(from)));
+                    static_cast<F*>(from)->~F();
+                },
+                [](void* storage) noexcept { static_cast<F*>(storage)->~F(); },
+            };
+            return &ops;
+        }
+
+        /// @brief Operations for callables stored on the heap with a pointer to them in the inline storage
+        template <typename F>
+        static const Operations* heap_operations() {
+            static const Operations ops = {
+                [](void* storage, Args&&... args) -> R {
+                    return (**static_cast<F**>(storage))(std::forward<Args>(args)...);
+                },
+                [](void* from, void* to) noexcept { *static_cast<F**>(to) = *static_cast<F**>(from); },
+                // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+                [](void* storage) noexcept { delete *static_cast<F**>(storage); },
+            };
+            return &ops;
+        }
+
+        template <typename F>
+        void store(F&& f, std::true_type /*fits_inline*/) {
+            new (&storage) std::decay_t<F>(std::forward<F>(f));
+            ops = inline_operations<std::decay_t<F>>();
+        }
+
+        template <typename F>
+        void store(F&& f, std::false_type /*fits_inline*/) {
+            *reinterpret_cast<std::decay_t<F>**>(&storage) = new std::decay_t<F>(std::forward<F>(f));
+            ops = heap_operations<std::decay_t<F>>();
+        }
+
+    public:
+        InlineFunction() noexcept = default;
+        InlineFunction(std::nullptr_t) noexcept {}  // NOLINT(google-explicit-constructor)
+
+        /**
+         * @brief Wraps a callable, moving or copying it into this function
+         *
+         * @param f the callable to wrap
+         */
+        template <typename F,
+                  typename = std::enable_if_t<!std::is_same<std::decay_t<F>, InlineFunction>::value
+                                              && !std::is_same<std::decay_t<F>, std::nullptr_t>::value>>
+        InlineFunction(F&& f) {  // NOLINT(google-explicit-constructor)
+            store(std::forward<F>(f), fits_inline<std::decay_t<F>>());
+        }
+
+        InlineFunction(InlineFunction&& other) noexcept : ops(other.ops) {
+            if (ops != nullptr) {
+                ops->move(&other.storage, &storage);
+                other.ops = nullptr;
+            }
+        }
+
+        InlineFunction& operator=(InlineFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                if (other.ops != nullptr) {
+                    other.ops->move(&other.storage, &storage);
+                    ops       = other.ops;
+                    other.ops = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        InlineFunction& operator=(std::nullptr_t) noexcept {
+            reset();
+            return *this;
+        }
+
+        InlineFunction(const InlineFunction&)            = delete;
+        InlineFunction& operator=(const InlineFunction&) = delete;
+
+        ~InlineFunction() {
+            reset();
+        }
+
+        /**
+         * @brief Calls the wrapped callable
+         *
+         * @throws std::bad_function_call if there is no callable
+         */
+        R operator()(Args... args) const {
+            if (ops == nullptr) {
+                throw std::bad_function_call();
+            }
+            return ops->invoke(&storage, std::forward<Args>(args)...);
+        }
+
+        /// @brief If there is a callable to call
+        explicit operator bool() const noexcept {
+            return ops != nullptr;
+        }
+
+    private:
+        void reset() noexcept {
+            if (ops != nullptr) {
+                ops->destroy(&storage);
+                ops = nullptr;
+            }
+        }
+
+        /// @brief The operations for the type of callable that is stored, or nullptr if there is no callable
+        const Operations* ops{nullptr};
+        /// @brief The storage for the callable, or for a pointer to it when it is on the heap
+        mutable std::aligned_storage_t<Capacity < sizeof(void*) ? sizeof(void*) : Capacity, alignof(std::max_align_t)>
+            storage;
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_INLINEFUNCTION_HPP
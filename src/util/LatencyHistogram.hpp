@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_LATENCYHISTOGRAM_HPP
+#define NUCLEAR_UTIL_LATENCYHISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief A histogram of durations with a fixed relative precision, that can be recorded into without locking.
+     *
+     * @details
+     *  Like an HDR histogram the buckets are exact for small values, and above that each power of two is split into
+     *  eight buckets so a bucket is never wider than an eighth of the values in it. Durations are recorded in
+     *  nanoseconds and anything longer than about 36 minutes goes into the last bucket.
+     *
+     *  Recording is a single relaxed atomic increment so it can happen while another thread drains the counts.
+     */
+    class LatencyHistogram {
+    public:
+        /// @brief The number of bits used to split each power of two into buckets
+        static constexpr unsigned SUB_BUCKET_BITS = 3;
+        /// @brief The number of buckets each power of two is split into
+        static constexpr uint64_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+        /// @brief The largest power of two that has its own buckets, larger durations go into the last bucket
+        static constexpr unsigned MAX_EXPONENT = 40;
+        /// @brief The total number of buckets, including the last one for durations that are too long
+        static constexpr size_t BUCKETS = SUB_BUCKETS * (MAX_EXPONENT - SUB_BUCKET_BITS + 2) + 1;
+
+        /// @brief The counts for each bucket, used to merge and query histograms
+        using Counts = std::array<uint64_t, BUCKETS>;
+
+        /**
+         * @brief Gets the bucket that a duration in nanoseconds is counted in
+         *
+         * @param value the duration in nanoseconds
+         *
+         * @return the index of the bucket
+         */
+        static size_t bucket(const uint64_t& value) {
+            if (value < 2 * SUB_BUCKETS) {
+                return size_t(value);
+            }
+            unsigned exponent = 0;
+            for (uint64_t v = value; v > 1; v >>= 1) {
+                ++exponent;
+            }
+            if (exponent > MAX_EXPONENT) {
+                return BUCKETS - 1;
+            }
+            const unsigned shift = exponent - SUB_BUCKET_BITS;
+            return size_t(SUB_BUCKETS * shift + (value >> shift));
+        }
+
+        /**
+         * @brief Gets the largest duration in nanoseconds that is counted in a bucket
+         *
+         * @param index the index of the bucket
+         *
+         * @return the largest value that is counted in the bucket
+         */
+        static uint64_t bucket_max(const size_t& index) {
+            if (index < 2 * SUB_BUCKETS) {
+                return index;
+            }
+            if (index == BUCKETS - 1) {
+                return UINT64_MAX;
+            }
+            const uint64_t shift = index / SUB_BUCKETS - 1;
+            const uint64_t value = index % SUB_BUCKETS + SUB_BUCKETS;
+            return ((value + 1) << shift) - 1;
+        }
+
+        /**
+         * @brief Gets a quantile of the durations in a set of counts
+         *
+         * @details The result is the largest value in the bucket the quantile falls in, so it is never an underestimate
+         *
+         * @param counts   the counts to get the quantile of
+         * @param quantile the quantile to get between 0 and 1, e.g. 0.99 for the 99th percentile
+         *
+         * @return the duration at the quantile, or zero if there are no counts
+         */
+        static std::chrono::nanoseconds value_at(const Counts& counts, const double& quantile) {
+            uint64_t total = 0;
+            for (const auto& c : counts) {
+                total += c;
+            }
+            if (total == 0) {
+                return std::chrono::nanoseconds(0);
+            }
+
+            // The rank of the value we are looking for, at least one so the 0th quantile is the smallest value
+            auto rank = uint64_t(quantile * double(total) + 0.5);
+            rank      = rank < 1 ? 1 : rank > total ? total : rank;
+
+            uint64_t seen = 0;
+            for (size_t i = 0; i < counts.size(); ++i) {
+                seen += counts[i];
+                if (seen >= rank) {
+                    return std::chrono::nanoseconds(
+                        int64_t(bucket_max(i) > uint64_t(INT64_MAX) ? INT64_MAX : bucket_max(i)));
+                }
+            }
+            return std::chrono::nanoseconds(0);
+        }
+
+        /**
+         * @brief Records a duration, negative durations are counted as zero
+         *
+         * @param duration the duration to record
+         */
+        template <typename Rep, typename Period>
+        void record(const std::chrono::duration<Rep, Period>& duration) noexcept {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            counts[bucket(ns < 0 ? 0 : uint64_t(ns))].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Adds everything that has been recorded to a set of counts and resets this histogram to empty
+         *
+         * @param into the counts to add to
+         */
+        void drain(Counts& into) noexcept {
+            for (size_t i = 0; i < BUCKETS; ++i) {
+                if (counts[i].load(std::memory_order_relaxed) != 0) {
+                    into[i] += counts[i].exchange(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+    private:
+        /// @brief The number of durations recorded in each bucket since the last drain
+        std::array<std::atomic<uint32_t>, BUCKETS> counts{};
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_LATENCYHISTOGRAM_HPP
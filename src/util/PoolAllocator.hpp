@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_POOLALLOCATOR_HPP
+#define NUCLEAR_UTIL_POOLALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+#include "FreeList.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief An allocator that recycles single objects through a FreeList for their size.
+     *
+     * @details
+     *  This is meant for std::allocate_shared so that messages which are emitted at a high rate, along with their
+     *  shared_ptr control block, reuse the memory of the messages before them rather than going to the heap. Arrays
+     *  and over aligned types are allocated from the heap as normal.
+     *
+     * @tparam T the type of object to allocate
+     */
+    template <typename T>
+    class PoolAllocator {
+    private:
+        /// @brief The size of the blocks the objects are kept in, which must be able to hold the free list's links
+        static constexpr size_t BLOCK_SIZE = sizeof(T) < 2 * sizeof(void*) ? 2 * sizeof(void*) : sizeof(T);
+        /// @brief If objects of this type can come from the free list, which only gives default aligned memory
+        static constexpr bool POOLED = alignof(T) <= alignof(std::max_align_t);
+
+    public:
+        using value_type = T;
+
+        PoolAllocator() noexcept = default;
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& /*other*/) noexcept {}  // NOLINT(google-explicit-constructor)
+
+        T* allocate(const size_t& n) {
+            if (n == 1 && POOLED) {
+                return static_cast<T*>(FreeList<BLOCK_SIZE>::allocate(size_t(BLOCK_SIZE)));
+            }
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, const size_t& n) noexcept {
+            if (n == 1 && POOLED) {
+                FreeList<BLOCK_SIZE>::deallocate(ptr, size_t(BLOCK_SIZE));
+            }
+            else {
+                ::operator delete(ptr);
+            }
+        }
+
+        /// @brief All pool allocators share the same free lists so any of them can free what another allocated
+        template <typename U>
+        bool operator==(const PoolAllocator<U>& /*other*/) const noexcept {
+            return true;
+        }
+        template <typename U>
+        bool operator!=(const PoolAllocator<U>& /*other*/) const noexcept {
+            return false;
+        }
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_POOLALLOCATOR_HPP
@@ -0,0 +1,341 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_RUNQUEUE_HPP
+#define NUCLEAR_UTIL_RUNQUEUE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief A priority queue of tasks which is first in first out for tasks of the same priority.
+     *
+     * @details
+     *  Each of the priorities from the Priority DSL word has its own bucket so that adding and removing tasks with
+     *  these priorities does not depend on how many tasks are in the queue. Within a bucket tasks are kept in order of
+     *  their id, since ids are almost always increasing this is normally just an append. Tasks with any other priority
+     *  go into a binary heap ordered by priority and then id, which only allocates when it grows past the most tasks
+     *  it has ever held rather than for every new priority.
+     *
+     *  When ordering by deadline, tasks that have a deadline are kept in a binary heap with the earliest deadline on
+     *  top and are removed before any of the tasks in the priority buckets. Unlike ids, deadlines arrive in any order
+     *  so a heap keeps adding and removing them logarithmic rather than linear in the number of tasks.
+     *
+     * @tparam T the type of task to store, it must have an integer `priority`, a comparable `id` and a time point
+     *           `deadline` member, where a deadline of the maximum time point means the task has no deadline
+     */
+    template <typename T>
+    class RunQueue {
+    private:
+        /**
+         * @brief A growable ring buffer of tasks that are all the same priority, sorted by their id.
+         *
+         * @details The capacity is always a power of two so that indexing is a mask rather than a division
+         */
+        class Bucket {
+        public:
+            bool empty() const {
+                return count == 0;
+            }
+
+            size_t size() const {
+                return count;
+            }
+
+            T& operator[](const size_t& i) {
+                return data[(head + i) & (data.size() - 1)];
+            }
+
+            void push(T&& item) {
+                if (count == data.size()) {
+                    grow();
+                }
+
+                // Insert at the back and move it forward until it is in order
+                size_t i  = count++;
+                (*this)[i] = std::move(item);
+                for (; i > 0 && (*this)[i].id < (*this)[i - 1].id; --i) {
+                    std::swap((*this)[i], (*this)[i - 1]);
+                }
+            }
+
+            T take(const size_t& index) {
+                T item = std::move((*this)[index]);
+
+                // Close the gap by moving the tasks in front of it back, for the front of the queue this is nothing
+                for (size_t i = index; i > 0; --i) {
+                    (*this)[i] = std::move((*this)[i - 1]);
+                }
+                head = (head + 1) & (data.size() - 1);
+                --count;
+                return item;
+            }
+
+        private:
+            void grow() {
+                std::vector<T> bigger(data.empty() ? 8 : data.size() * 2);
+                for (size_t i = 0; i < count; ++i) {
+                    bigger[i] = std::move((*this)[i]);
+                }
+                data = std::move(bigger);
+                head = 0;
+            }
+
+            /// @brief The storage for the ring buffer
+            std::vector<T> data;
+            /// @brief The index in data of the first task
+            size_t head{0};
+            /// @brief The number of tasks in the bucket
+            size_t count{0};
+        };
+
+        /// @brief The type of a task's deadline
+        using Deadline = decltype(T::deadline);
+
+        /// @brief If the first task should be removed before the second when both have a deadline
+        static bool deadline_order(const T& a, const T& b) {
+            return a.deadline == b.deadline ? a.id < b.id : a.deadline < b.deadline;
+        }
+
+        /// @brief The heap comparison for the deadline tasks, which puts the task that is removed first on top
+        static bool later_deadline(const T& a, const T& b) {
+            return deadline_order(b, a);
+        }
+
+        /// @brief If the first task should be removed before the second when neither has a deadline
+        static bool priority_order(const T& a, const T& b) {
+            return a.priority == b.priority ? a.id < b.id : a.priority > b.priority;
+        }
+
+        /// @brief The heap comparison for the overflow tasks, which puts the task that is removed first on top
+        static bool lower_priority(const T& a, const T& b) {
+            return priority_order(b, a);
+        }
+
+        /**
+         * @brief Finds the first task in a heap that satisfies the predicate
+         *
+         * @param heap      the heap to search, which has the task that is removed first on top
+         * @param predicate a function taking a task that returns true if the task should be taken
+         * @param order     a function that returns true if its first task is removed before its second
+         *
+         * @return the first task that satisfies the predicate, or the end of the heap if there is none
+         */
+        template <typename Predicate, typename Order>
+        static typename std::vector<T>::iterator find_heap(std::vector<T>& heap, Predicate&& predicate, Order&& order) {
+            if (heap.empty()) {
+                return heap.end();
+            }
+
+            // The top of the heap is the first task, which is the only one that is looked at when popping
+            if (predicate(heap.front())) {
+                return heap.begin();
+            }
+
+            // Otherwise the rest of the heap is in no particular order so every task has to be checked
+            auto best = heap.end();
+            for (auto it = std::next(heap.begin()); it != heap.end(); ++it) {
+                if (predicate(*it) && (best == heap.end() || order(*it, *best))) {
+                    best = it;
+                }
+            }
+            return best;
+        }
+
+        /**
+         * @brief Removes a task from a heap
+         *
+         * @param heap    the heap to remove the task from
+         * @param it      the task to remove
+         * @param compare the comparison the heap is ordered by
+         *
+         * @return the task that was removed
+         */
+        template <typename Compare>
+        static T take_heap(std::vector<T>& heap, const typename std::vector<T>::iterator& it, Compare&& compare) {
+            if (it == heap.begin()) {
+                std::pop_heap(heap.begin(), heap.end(), compare);
+                T item = std::move(heap.back());
+                heap.pop_back();
+                return item;
+            }
+
+            T item = std::move(*it);
+            if (it != std::prev(heap.end())) {
+                *it = std::move(heap.back());
+            }
+            heap.pop_back();
+            std::make_heap(heap.begin(), heap.end(), compare);
+            return item;
+        }
+
+        /// @brief The priorities that have a fixed bucket (REALTIME, HIGH, NORMAL, LOW and IDLE) from highest to lowest
+        static constexpr int standard_priority(const size_t& index) {
+            return index == 0 ? 1000 : index == 1 ? 750 : index == 2 ? 500 : index == 3 ? 250 : 0;
+        }
+
+        /// @brief The bucket index for a priority, or -1 if the priority does not have a fixed bucket
+        static int bucket_index(const int& priority) {
+            switch (priority) {
+                case standard_priority(0): return 0;
+                case standard_priority(1): return 1;
+                case standard_priority(2): return 2;
+                case standard_priority(3): return 3;
+                case standard_priority(4): return 4;
+                default: return -1;
+            }
+        }
+
+    public:
+        /**
+         * @brief Constructs an empty queue
+         *
+         * @param earliest_deadline_first if tasks that have a deadline should be ordered by it ahead of all priorities
+         */
+        explicit RunQueue(const bool& earliest_deadline_first = false)
+            : earliest_deadline_first(earliest_deadline_first) {}
+
+        /**
+         * @brief Adds a task to the queue behind all the tasks with the same priority (or deadline) and a lower id
+         *
+         * @param item the task to add
+         */
+        void push(T&& item) {
+            const int index = bucket_index(item.priority);
+            if (earliest_deadline_first && item.deadline != Deadline::max()) {
+                deadlines.push_back(std::move(item));
+                std::push_heap(deadlines.begin(), deadlines.end(), later_deadline);
+            }
+            else if (index >= 0) {
+                buckets[index].push(std::move(item));
+            }
+            else {
+                overflow.push_back(std::move(item));
+                std::push_heap(overflow.begin(), overflow.end(), lower_priority);
+            }
+            ++count;
+        }
+
+        /**
+         * @brief Removes the first task, in priority order, that satisfies the predicate
+         *
+         * @param predicate a function taking a task that returns true if the task should be taken
+         * @param item      where the task is moved to if one is found
+         *
+         * @return true if a task was found and moved into item
+         */
+        template <typename Predicate>
+        bool take_first(Predicate&& predicate, T& item) {
+            const auto deadline = find_heap(deadlines, predicate, deadline_order);
+            if (deadline != deadlines.end()) {
+                item = take_heap(deadlines, deadline, later_deadline);
+                --count;
+                return true;
+            }
+
+            // The first overflow task goes ahead of the buckets with a lower priority than it
+            const auto other = find_heap(overflow, predicate, priority_order);
+            for (size_t i = 0; i < buckets.size(); ++i) {
+                if (other != overflow.end() && other->priority > standard_priority(i)) {
+                    break;
+                }
+                for (size_t index = 0; index < buckets[i].size(); ++index) {
+                    if (predicate(buckets[i][index])) {
+                        item = buckets[i].take(index);
+                        --count;
+                        return true;
+                    }
+                }
+            }
+
+            if (other == overflow.end()) {
+                return false;
+            }
+            item = take_heap(overflow, other, lower_priority);
+            --count;
+            return true;
+        }
+
+        /**
+         * @brief Removes the first task in priority order
+         *
+         * @param item where the task is moved to if the queue is not empty
+         *
+         * @return true if the queue was not empty and a task was moved into item
+         */
+        bool pop(T& item) {
+            return take_first([](const T&) { return true; }, item);
+        }
+
+        /**
+         * @brief Gets the priority of the task that would be removed by pop
+         *
+         * @return the highest priority in the queue, or the lowest possible int if the queue is empty. When ordering by
+         *         deadline and there is a task with a deadline this is the highest possible int
+         */
+        int top_priority() {
+            if (!deadlines.empty()) {
+                return std::numeric_limits<int>::max();
+            }
+            const int priority = overflow.empty() ? std::numeric_limits<int>::min() : overflow.front().priority;
+            for (size_t i = 0; i < buckets.size(); ++i) {
+                if (!buckets[i].empty()) {
+                    return std::max(priority, standard_priority(i));
+                }
+            }
+            return priority;
+        }
+
+        /// @brief If there are no tasks in the queue
+        bool empty() const {
+            return count == 0;
+        }
+
+        /// @brief The number of tasks in the queue
+        size_t size() const {
+            return count;
+        }
+
+    private:
+        /// @brief If tasks that have a deadline are ordered by it ahead of all the priority buckets
+        bool earliest_deadline_first;
+        /// @brief The tasks with a deadline when ordering by deadline, as a heap with the earliest deadline on top
+        std::vector<T> deadlines{};
+        /// @brief The buckets for the standard priorities, from highest priority to lowest
+        std::array<Bucket, 5> buckets{};
+        /// @brief The tasks with any other priority, as a heap with the highest priority and then lowest id on top
+        std::vector<T> overflow{};
+        /// @brief The total number of tasks in the queue
+        size_t count{0};
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_RUNQUEUE_HPP
@@ -24,6 +24,8 @@
 #define NUCLEAR_UTIL_THREADPOOL_HPP
 
 #include <atomic>
+#include <bitset>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 
@@ -32,6 +34,50 @@
 namespace NUClear {
 namespace util {
 
+    /// @brief A set of cpus indexed by their number as the operating system sees them
+    using CPUSet = std::bitset<1024>;
+
+    /// @brief How a thread pool chooses which of its queued tasks to run next
+    enum class SchedulingPolicy {
+        /// @brief Run the task with the highest priority, then the lowest task id
+        PRIORITY,
+        /// @brief Run the task with the earliest deadline, tasks without a deadline then run in priority order
+        EARLIEST_DEADLINE_FIRST
+    };
+
+    /**
+     * @brief The settings for how a thread pool runs its threads and tasks.
+     *
+     * @details
+     *  These are only read once when the pool is created, so they are kept apart from the ThreadPoolDescriptor which
+     *  is copied into every task.
+     */
+    struct ThreadPoolOptions {
+        /// @brief how long an idle thread in this pool will spin looking for a new task before it goes to sleep
+        std::chrono::nanoseconds spin_duration{0};
+
+        /// @brief the cpus the threads in this pool are pinned to, when this is empty the threads are not pinned
+        CPUSet cpu_set{};
+
+        /// @brief the numa node the threads in this pool allocate memory from, or -1 to use the system default
+        int numa_node{-1};
+
+        /// @brief how the threads in this pool choose which queued task to run next
+        SchedulingPolicy scheduling_policy{SchedulingPolicy::PRIORITY};
+
+        /// @brief the most threads this pool will grow to, if this is not more than thread_count the pool never grows
+        size_t max_thread_count{0};
+
+        /// @brief an elastic pool adds a thread when this many tasks are queued and none of its threads are idle
+        size_t grow_queue_depth{4};
+
+        /// @brief an elastic pool adds a thread when a task waited this long to start and none of its threads are idle
+        std::chrono::nanoseconds grow_wait_time{std::chrono::milliseconds(1)};
+
+        /// @brief threads an elastic pool added are removed again after being idle for this long
+        std::chrono::nanoseconds idle_timeout{std::chrono::seconds(1)};
+    };
+
     /**
      * @brief A description of a thread pool
      */
@@ -39,9 +85,12 @@ namespace util {
         /// @brief a unique identifier for this pool
         NUClear::id_t pool_id{ThreadPoolDescriptor::DEFAULT_THREAD_POOL_ID};
 
-        /// @brief the number of threads this thread pool will use
+        /// @brief the number of threads this thread pool will use, or the fewest it will shrink to if it is elastic
         size_t thread_count{0};
 
+        /// @brief the settings used when this pool is created, which must outlive the pool, or nullptr for the defaults
+        const ThreadPoolOptions* options{nullptr};
+
         /// @brief the ID of the main thread pool (not to be confused with the ID of the main thread)
         static const NUClear::id_t MAIN_THREAD_POOL_ID;
         /// @brief the ID of the default thread pool
@@ -0,0 +1,46 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_THREADPRIORITYPOLICY_HPP
+#define NUCLEAR_UTIL_THREADPRIORITYPOLICY_HPP
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief How the priority of a task is applied to the operating system priority of the thread that runs it
+     */
+    enum class ThreadPriorityPolicy {
+        /// @brief Thread priorities are never changed, use this when the process isn't allowed to change them
+        OFF,
+        /// @brief Threads use normal time shared scheduling with a nice value from -10 (REALTIME) to 10 (IDLE)
+        NICE,
+        /// @brief Threads use realtime round robin scheduling, which needs permission to use realtime priorities
+        ROUND_ROBIN,
+        /// @brief Threads use realtime first in first out scheduling, which needs permission to use realtime priorities
+        FIFO
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_THREADPRIORITYPOLICY_HPP
@@ -23,13 +23,102 @@
 #ifndef NUCLEAR_UTIL_TYPELIST_HPP
 #define NUCLEAR_UTIL_TYPELIST_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <vector>
 
+#include "platform.hpp"
+
 namespace NUClear {
 namespace util {
 
+    /**
+     * @brief A version of a type list that a thread has cached, which can be dropped once it is out of date.
+     *
+     * @details
+     *  Each thread keeps a list of its caches so that it can let go of old versions of the lists without waiting until
+     *  it next reads them. Otherwise items that were removed, such as unbound reactions, stay alive for as long as a
+     *  thread that read them before never reads that list again.
+     */
+    class TypeListCache {
+    public:
+        TypeListCache() : next(head()) {
+            if (next != nullptr) {
+                next->prev = this;
+            }
+            head() = this;
+        }
+        virtual ~TypeListCache() {
+            (prev != nullptr ? prev->next : head()) = next;
+            if (next != nullptr) {
+                next->prev = prev;
+            }
+        }
+        TypeListCache(const TypeListCache& /*other*/)               = delete;
+        TypeListCache(TypeListCache&& /*other*/) noexcept           = delete;
+        TypeListCache operator=(const TypeListCache& /*other*/)     = delete;
+        TypeListCache operator=(TypeListCache&& /*other*/) noexcept = delete;
+
+        /// @brief Drops the cached version of the list if a newer version has been published since it was read
+        virtual void release() = 0;
+
+        /// @brief Incremented each time an item is removed from any type list
+        static std::atomic<uint64_t>& epoch() {
+            static std::atomic<uint64_t> e{0};
+            return e;
+        }
+
+        /**
+         * @brief Drops every cache on this thread that is out of date, if anything has been removed from a list
+         *
+         * @details
+         *  This is called by threads at points where they are not using any list, such as between tasks. When nothing
+         *  has been removed since the last call it is a single atomic load.
+         */
+        static void release_stale() {
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+            static ATTRIBUTE_TLS uint64_t seen = 0;
+            const uint64_t current             = epoch().load(std::memory_order_acquire);
+            if (current != seen) {
+                seen = current;
+                for (TypeListCache* cache = head(); cache != nullptr; cache = cache->next) {
+                    cache->release();
+                }
+            }
+        }
+
+    private:
+        /// @brief The first cache on the current thread
+        static TypeListCache*& head() {
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+            static ATTRIBUTE_TLS TypeListCache* first = nullptr;
+            return first;
+        }
+
+        /// @brief The caches before and after this one on the same thread
+        TypeListCache* next;
+        TypeListCache* prev{nullptr};
+    };
+
+    /**
+     * @brief A static list for each key type that can be read from many threads while it is being changed.
+     *
+     * @details
+     *  The list is copy on write. Each change makes a new version of the list and publishes it by incrementing a
+     *  version number. Each thread caches the version of the list it last read, so reading is a single atomic load to
+     *  check the version is still current. Only after a change does a reader take the lock to get the new version.
+     *  Versions are reference counted, so a version that a thread is iterating stays valid until it's finished,
+     *  even if the list is changed part way through. Removing an item also lets threads drop their old versions
+     *  through TypeListCache::release_stale, so the item isn't kept alive by threads that never read the list again.
+     *
+     * @tparam MapID the type that identifies which map this list belongs to
+     * @tparam Key   the type that identifies the list within the map
+     * @tparam Value the type of the items in the list
+     */
     template <typename MapID, typename Key, typename Value>
     class TypeList {
     public:
@@ -41,24 +130,104 @@ namespace util {
         TypeList operator=(const TypeList& /*other*/)     = delete;
         TypeList operator=(TypeList&& /*other*/) noexcept = delete;
 
+        /// @brief A version of the list, which never changes once it has been published
+        using Snapshot = std::vector<Value>;
+
     private:
-        /// @brief the data variable where the data is stored for this map key.
-        static std::vector<Value> data;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+        /// @brief The current version of the list and the lock that writers hold while they replace it
+        struct Master {
+            std::mutex mutex;
+            std::shared_ptr<const Snapshot> current{std::make_shared<const Snapshot>()};
+        };
+
+        /// @brief The version of the list that a thread last read
+        struct Cache : public TypeListCache {
+            void release() override {
+                if (this->version != TypeList::version.load(std::memory_order_relaxed)) {
+                    this->version = std::numeric_limits<uint64_t>::max();
+                    snapshot.reset();
+                }
+            }
+            uint64_t version{std::numeric_limits<uint64_t>::max()};
+            std::shared_ptr<const Snapshot> snapshot;
+        };
+
+        static Master& master() {
+            static Master m;
+            return m;
+        }
+
+        /// @brief Replaces the current list with a new version, the caller must hold the master lock
+        static void publish(Master& m, std::shared_ptr<const Snapshot>&& next) {
+            m.current = std::move(next);
+            version.fetch_add(1, std::memory_order_release);
+        }
+
+        /// @brief Incremented each time a new version of the list is published
+        static std::atomic<uint64_t> version;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
     public:
         /**
-         * @brief Gets the list that is stored in this type location
+         * @brief Gets the current version of the list
+         *
+         * @details
+         *  The reference is to this thread's cached version, which is replaced the next time this thread calls get
+         *  after the list has changed. Anything that could call get again while it is using the list, for example by
+         *  running a reaction, must take a copy of the shared_ptr.
+         *
+         * @return the current version of the list
+         */
+        static const std::shared_ptr<const Snapshot>& get() {
+            static thread_local Cache cache;
+            if (cache.version != version.load(std::memory_order_acquire)) {
+                Master& m = master();
+                const std::lock_guard<std::mutex> lock(m.mutex);
+                cache.snapshot = m.current;
+                cache.version  = version.load(std::memory_order_relaxed);
+            }
+            return cache.snapshot;
+        }
+
+        /**
+         * @brief Adds an item to the end of the list
+         *
+         * @param value the item to add
+         */
+        static void add(const Value& value) {
+            Master& m = master();
+            const std::lock_guard<std::mutex> lock(m.mutex);
+            auto next = std::make_shared<Snapshot>(*m.current);
+            next->push_back(value);
+            publish(m, std::move(next));
+        }
+
+        /**
+         * @brief Removes the first item that matches a predicate
+         *
+         * @param predicate a function taking an item that returns true for the item to remove
          *
-         * @return A reference to the vector stored in this location
+         * @return true if an item was found and removed
          */
-        static std::vector<Value>& get() {
-            return data;
+        template <typename Predicate>
+        static bool remove(Predicate&& predicate) {
+            Master& m = master();
+            const std::lock_guard<std::mutex> lock(m.mutex);
+            auto it = std::find_if(m.current->begin(), m.current->end(), predicate);
+            if (it == m.current->end()) {
+                return false;
+            }
+            auto next = std::make_shared<Snapshot>(*m.current);
+            next->erase(next->begin() + (it - m.current->begin()));
+            publish(m, std::move(next));
+            TypeListCache::epoch().fetch_add(1, std::memory_order_release);
+            return true;
         }
     };
 
-    /// Initialize our type list data
+    /// Initialize our type list version
     template <typename MapID, typename Key, typename Value>
-    std::vector<Value> TypeList<MapID, Key, Value>::data;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    std::atomic<uint64_t> TypeList<MapID, Key, Value>::version{0};
 
 }  // namespace util
 }  // namespace NUClear
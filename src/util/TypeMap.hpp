@@ -23,9 +23,11 @@
 #ifndef NUCLEAR_UTIL_TYPEMAP_HPP
 #define NUCLEAR_UTIL_TYPEMAP_HPP
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
-#include <vector>
+#include <thread>
 
 namespace NUClear {
 namespace util {
@@ -57,9 +59,37 @@ namespace util {
         TypeMap operator=(TypeMap&& /*other*/) noexcept = delete;
 
     private:
-        /// @brief the data variable where the data is stored for this map key.
-        static std::shared_ptr<Value> data;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-        static std::mutex mutex;             // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+        /**
+         * @brief The two copies of the value and the counters that let readers use one while the other is written.
+         *
+         * @details
+         *  This is a left right scheme. Readers announce themselves on a counter, then copy whichever of the two values
+         *  is marked for reading. A writer changes the value readers aren't using, points readers at it, and waits for
+         *  the readers that might still be copying the other one to finish before changing that one too. Readers never
+         *  wait for anything, only writers wait for readers, and only for as long as it takes to copy a shared_ptr.
+         */
+        struct State {
+            /// @brief Held by writers so only one of them changes the values at a time
+            std::mutex mutex;
+            /// @brief The two copies of the value, outside of a write both hold the same pointer
+            std::array<std::shared_ptr<Value>, 2> values;
+            /// @brief Which of the two values readers should copy
+            std::atomic<int> read_index{0};
+            /// @brief Which of the two reader counters new readers should use
+            std::atomic<int> counter_index{0};
+            /// @brief The number of readers currently copying a value, for each counter
+            std::array<std::atomic<int>, 2> readers{};
+        };
+
+        /// @brief the state where the data is stored for this map key.
+        static State state;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+        /// @brief Waits until no readers are using the given counter
+        static void wait_for_readers(const int& counter) {
+            while (state.readers[counter].load() != 0) {
+                std::this_thread::yield();
+            }
+        }
 
     public:
         /**
@@ -69,40 +99,48 @@ namespace util {
          */
         static void set(std::shared_ptr<Value> d) {
 
-            // Do this once G++ supports it
-            // std::atomic_store_explicit(&data, d, std::memory_order_relaxed);
+            // The old value is released once we no longer hold the lock in case its destructor is expensive
+            std::shared_ptr<Value> old;
+            {
+                const std::lock_guard<std::mutex> lock(state.mutex);
+
+                // Readers only look at read_index so we can change the other value
+                const int read = state.read_index.load();
+                state.values[1 - read] = d;
+                state.read_index.store(1 - read);
 
-            // Lock a mutex and set our data
-            const std::lock_guard<std::mutex> lock(mutex);
-            data = std::move(d);
+                // Any reader that might still be copying the old value is counted on one of the two counters
+                const int counter = state.counter_index.load();
+                wait_for_readers(1 - counter);
+                state.counter_index.store(1 - counter);
+                wait_for_readers(counter);
+
+                // Now nothing is reading the old value and it can be replaced
+                old                = std::move(state.values[read]);
+                state.values[read] = std::move(d);
+            }
         }
 
         /**
          * @brief Gets the value that was previously stored.
          *
+         * @details This never blocks, even if another thread is storing a new value at the same time
+         *
          * @return a shared_ptr to the data that was previously stored
          */
         static std::shared_ptr<Value> get() {
-
-            // TODO(Trent) do this when gcc supports it
-            // std::atomic_load_explicit(&data, std::memory_order_relaxed);
-
-            std::shared_ptr<Value> d;
-            {
-                const std::lock_guard<std::mutex> lock(mutex);
-                d = data;
-            }
-
+            const int counter = state.counter_index.load();
+            state.readers[counter].fetch_add(1);
+            std::shared_ptr<Value> d = state.values[state.read_index.load()];
+            state.readers[counter].fetch_sub(1);
             return d;
         }
     };
 
     /// Initialize our shared_ptr data
     template <typename MapID, typename Key, typename Value>
-    std::shared_ptr<Value>
-        TypeMap<MapID, Key, Value>::data;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-    template <typename MapID, typename Key, typename Value>
-    std::mutex TypeMap<MapID, Key, Value>::mutex;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    typename TypeMap<MapID, Key, Value>::State
+        TypeMap<MapID, Key, Value>::state;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 }  // namespace util
 }  // namespace NUClear
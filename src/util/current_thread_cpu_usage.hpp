@@ -0,0 +1,93 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_CURRENT_THREAD_CPU_USAGE_HPP
+#define NUCLEAR_UTIL_CURRENT_THREAD_CPU_USAGE_HPP
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__linux__) || defined(__APPLE__)
+    #include <sys/resource.h>
+    #include <time.h>
+#endif  // __linux__ || __APPLE__
+
+#ifdef _WIN32
+    #include "platform.hpp"
+#endif  // _WIN32
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief How much cpu the current thread has used since it started.
+     */
+    struct ThreadCPUUsage {
+        /// @brief The time the thread has spent running on a cpu, in user and kernel mode
+        std::chrono::nanoseconds cpu_time{0};
+        /// @brief The number of times the thread gave up the cpu, such as to wait on a lock or for io
+        uint64_t voluntary_context_switches{0};
+        /// @brief The number of times the thread was taken off the cpu so another thread could run
+        uint64_t involuntary_context_switches{0};
+    };
+
+    /**
+     * @brief Reads how much cpu the current thread has used.
+     *
+     * @details
+     *  The cpu time is available on linux, macOS and windows while the context switches are only available on linux.
+     *  Anything that isn't available is left as zero
+     *
+     * @return the cpu usage of the current thread
+     */
+    inline ThreadCPUUsage current_thread_cpu_usage() {
+        ThreadCPUUsage usage;
+#if defined(__linux__) || defined(__APPLE__)
+        timespec ts{};
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+            usage.cpu_time = std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+        }
+#endif  // __linux__ || __APPLE__
+#ifdef __linux__
+        rusage ru{};
+        if (getrusage(RUSAGE_THREAD, &ru) == 0) {
+            usage.voluntary_context_switches   = uint64_t(ru.ru_nvcsw);
+            usage.involuntary_context_switches = uint64_t(ru.ru_nivcsw);
+        }
+#endif  // __linux__
+#ifdef _WIN32
+        FILETIME creation, exit, kernel, user;
+        if (GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+            // Thread times are in units of 100 nanoseconds
+            const auto ticks = [](const FILETIME& t) {
+                return (uint64_t(t.dwHighDateTime) << 32) | uint64_t(t.dwLowDateTime);
+            };
+            usage.cpu_time = std::chrono::nanoseconds((ticks(kernel) + ticks(user)) * 100);
+        }
+#endif  // _WIN32
+        return usage;
+    }
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_CURRENT_THREAD_CPU_USAGE_HPP
@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_SET_CURRENT_THREAD_AFFINITY_HPP
+#define NUCLEAR_UTIL_SET_CURRENT_THREAD_AFFINITY_HPP
+
+#include <cerrno>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "ThreadPoolDescriptor.hpp"
+
+#ifdef __linux__
+    #include <linux/mempolicy.h>
+    #include <pthread.h>
+    #include <sched.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif  // __linux__
+
+#ifdef _WIN32
+    #include "platform.hpp"
+#endif  // _WIN32
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief Reads the cpus that belong to a numa node.
+     *
+     * @details This is only available on linux, on other platforms or if the node doesn't exist the set is empty
+     *
+     * @param node the numa node to get the cpus for
+     *
+     * @return the cpus that belong to the numa node
+     */
+    inline CPUSet numa_node_cpus(const int& node) {
+        CPUSet cpus{};
+#ifdef __linux__
+        // The cpulist is a comma separated list of ranges, e.g. 0-3,8-11
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string range;
+        while (std::getline(file, range, ',')) {
+            try {
+                const size_t dash = range.find('-');
+                const size_t low  = std::stoul(range.substr(0, dash));
+                const size_t high = dash == std::string::npos ? low : std::stoul(range.substr(dash + 1));
+                for (size_t cpu = low; cpu <= high && cpu < cpus.size(); ++cpu) {
+                    cpus.set(cpu);
+                }
+            }
+            catch (const std::exception&) {
+                // Not a range we understand, skip it
+            }
+        }
+#else
+        (void) node;
+#endif  // __linux__
+        return cpus;
+    }
+
+    /**
+     * @brief Restricts the current thread to run only on the given cpus.
+     *
+     * @details On platforms that don't support hard affinity (e.g. macOS) this does nothing
+     *
+     * @param cpus the cpus the thread may run on, if this is empty the affinity is not changed
+     *
+     * @return 0 if the affinity was set or didn't need to be, otherwise the error code from the operating system
+     */
+    inline int set_current_thread_affinity(const CPUSet& cpus) {
+        if (cpus.none()) {
+            return 0;
+        }
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (size_t cpu = 0; cpu < cpus.size() && cpu < CPU_SETSIZE; ++cpu) {
+            if (cpus.test(cpu)) {
+                CPU_SET(cpu, &set);
+            }
+        }
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(_WIN32)
+        DWORD_PTR mask = 0;
+        for (size_t cpu = 0; cpu < cpus.size() && cpu < sizeof(DWORD_PTR) * 8; ++cpu) {
+            if (cpus.test(cpu)) {
+                mask |= DWORD_PTR(1) << cpu;
+            }
+        }
+        return SetThreadAffinityMask(GetCurrentThread(), mask) != 0 ? 0 : int(GetLastError());
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief Makes the memory that the current thread allocates come from the given numa node where possible.
+     *
+     * @details
+     *  This is only available on linux. The policy is preferred rather than strict so allocations still succeed if
+     *  the node runs out of memory.
+     *
+     * @param node the numa node to allocate memory from, if this is negative the policy is not changed
+     *
+     * @return 0 if the policy was set or didn't need to be, otherwise the error code from the operating system
+     */
+    inline int set_current_thread_numa_node(const int& node) {
+        if (node < 0) {
+            return 0;
+        }
+#ifdef __linux__
+        // The node mask is an array of longs with enough bits to hold the node
+        // NOLINTNEXTLINE(google-runtime-int)
+        constexpr size_t bits = sizeof(unsigned long) * 8;
+        // NOLINTNEXTLINE(google-runtime-int)
+        std::vector<unsigned long> mask(size_t(node) / bits + 1, 0);
+        mask.back() = 1UL << (size_t(node) % bits);
+
+        // The kernel only reads maxnode - 1 bits of the mask, so it is one more than the number of bits in it
+        const unsigned long maxnode = mask.size() * bits + 1;  // NOLINT(google-runtime-int)
+        return syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask.data(), maxnode) == 0 ? 0 : errno;
+#else
+        return 0;
+#endif  // __linux__
+    }
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_SET_CURRENT_THREAD_AFFINITY_HPP
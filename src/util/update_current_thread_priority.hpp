@@ -23,32 +23,150 @@
 #ifndef NUCLEAR_UTIL_UPDATE_CURRENT_THREAD_PRIORITY_HPP
 #define NUCLEAR_UTIL_UPDATE_CURRENT_THREAD_PRIORITY_HPP
 
-#ifndef _WIN32
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+
+#include "ThreadPriorityPolicy.hpp"
+#include "platform.hpp"
 
+#ifndef _WIN32
     #include <pthread.h>
+    #include <sched.h>
+#endif  // ndef _WIN32
 
-inline void update_current_thread_priority(int priority) {
+#ifdef __linux__
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif  // __linux__
 
-    // TODO(Trent) SCHED_NORMAL for normal threads
-    // TODO(Trent) SCHED_FIFO for realtime threads
-    // TODO(Trent) SCHED_RR for high priority threads
+namespace NUClear {
+namespace util {
 
-    auto sched_priority = sched_get_priority_min(SCHED_RR)
-                          + (priority / (sched_get_priority_max(SCHED_RR) - sched_get_priority_min(SCHED_RR)));
+    /**
+     * @brief The policy that is used when changing the priority of threads, shared by every thread in the process
+     *
+     * @details This defaults to ROUND_ROBIN and is set from the Configuration when a PowerPlant is created
+     */
+    inline std::atomic<ThreadPriorityPolicy>& thread_priority_policy() {
+        static std::atomic<ThreadPriorityPolicy> policy{ThreadPriorityPolicy::ROUND_ROBIN};
+        return policy;
+    }
 
-    sched_param p{};
-    p.sched_priority = sched_priority;
-    pthread_setschedparam(pthread_self(), SCHED_RR, &p);
-}
-#endif  // ndef _WIN32
+    /**
+     * @brief Sets the policy that is used when changing the priority of threads
+     *
+     * @param policy the new policy, threads move to it the next time their priority is updated
+     */
+    inline void set_thread_priority_policy(const ThreadPriorityPolicy& policy) {
+        thread_priority_policy().store(policy, std::memory_order_relaxed);
+    }
 
-#ifdef _WIN32
+    /**
+     * @brief Converts a task priority into the value the operating system uses for a policy
+     *
+     * @param policy   the policy that will be used to apply the priority
+     * @param priority the priority of the task between 0 (IDLE) and 1000 (REALTIME)
+     *
+     * @return the nice value for NICE, the scheduling priority for the realtime policies, or on windows the index of
+     *         the thread priority
+     */
+    inline int thread_priority_level(const ThreadPriorityPolicy& policy, const int& priority) {
+#ifndef _WIN32
+        if (policy == ThreadPriorityPolicy::NICE) {
+            return std::min(19, std::max(-20, (500 - priority) / 50));
+        }
+        const int sched_policy = policy == ThreadPriorityPolicy::FIFO ? SCHED_FIFO : SCHED_RR;
+        const int min          = sched_get_priority_min(sched_policy);
+        const int max          = sched_get_priority_max(sched_policy);
+        // Only the bottom of the realtime range is used so that other realtime programs on the system keep their
+        // place above us, spread evenly so IDLE is the lowest priority and REALTIME the top of the part that is used
+        const int top = std::min(max, min + 1000 / (max - min));
+        return min + std::min(1000, std::max(0, priority)) * (top - min) / 1000;
+#else
+        // Windows has a single set of thread priorities which every policy uses
+        (void) policy;
+        return (priority * 7) / 1000;
+#endif  // ndef _WIN32
+    }
 
-    #include "platform.hpp"
+}  // namespace util
+}  // namespace NUClear
 
+/**
+ * @brief Sets the operating system priority of the current thread to match a task priority.
+ *
+ * @details
+ *  How the priority is applied depends on util::thread_priority_policy(). Each thread remembers the last policy and
+ *  value it used so the system call is only made when they change. If the process is not permitted to use a realtime
+ *  policy, or to make a thread less nice, the policy is turned off so later tasks don't pay for system calls that will
+ *  fail.
+ *
+ * @param priority the priority of the task between 0 (IDLE) and 1000 (REALTIME)
+ */
 inline void update_current_thread_priority(int priority) {
+    using NUClear::util::ThreadPriorityPolicy;
+
+    // The priority that was last set on this thread, OFF means the thread has not been changed yet
+    static ATTRIBUTE_TLS ThreadPriorityPolicy current_policy = ThreadPriorityPolicy::OFF;
+    static ATTRIBUTE_TLS int current_level                   = 0;
+
+    const ThreadPriorityPolicy policy = NUClear::util::thread_priority_policy().load(std::memory_order_relaxed);
+    if (policy == ThreadPriorityPolicy::OFF) {
+        return;
+    }
+    const int level = NUClear::util::thread_priority_level(policy, priority);
+    if (policy == current_policy && level == current_level) {
+        return;
+    }
+
+    // Remember the change even if it fails so that it isn't attempted again for every task
+    const ThreadPriorityPolicy previous_policy = current_policy;
+    current_policy                             = policy;
+    current_level                              = level;
 
-    switch ((priority * 7) / 1000) {
+#ifndef _WIN32
+    if (policy == ThreadPriorityPolicy::NICE) {
+        sched_param p{};
+        if (previous_policy == ThreadPriorityPolicy::ROUND_ROBIN || previous_policy == ThreadPriorityPolicy::FIFO) {
+            pthread_setschedparam(pthread_self(), SCHED_OTHER, &p);
+        }
+    #ifdef __linux__
+        // On linux the nice value of a thread can be set on its own by using its thread id. Without permission a thread
+        // can only ever be made nicer and never come back, so before the first change check we can make it less nice
+        const auto tid = static_cast<id_t>(syscall(SYS_gettid));
+        const bool permitted =
+            (previous_policy == ThreadPriorityPolicy::NICE
+             || setpriority(PRIO_PROCESS, tid, NUClear::util::thread_priority_level(policy, 1000)) == 0)
+            && setpriority(PRIO_PROCESS, tid, level) == 0;
+        if (!permitted && (errno == EACCES || errno == EPERM)) {
+            ThreadPriorityPolicy expected = policy;
+            NUClear::util::thread_priority_policy().compare_exchange_strong(expected, ThreadPriorityPolicy::OFF);
+        }
+    #else
+        // Elsewhere the normal policy has its own range of priorities where larger is more important
+        const int min    = sched_get_priority_min(SCHED_OTHER);
+        const int max    = sched_get_priority_max(SCHED_OTHER);
+        p.sched_priority = max - ((level + 20) * (max - min)) / 39;
+        pthread_setschedparam(pthread_self(), SCHED_OTHER, &p);
+    #endif  // __linux__
+    }
+    else {
+        sched_param p{};
+        p.sched_priority = level;
+        const int error =
+            pthread_setschedparam(pthread_self(), policy == ThreadPriorityPolicy::FIFO ? SCHED_FIFO : SCHED_RR, &p);
+
+        // Without permission to use realtime scheduling every attempt will fail, so stop trying
+        if (error == EPERM) {
+            ThreadPriorityPolicy expected = policy;
+            NUClear::util::thread_priority_policy().compare_exchange_strong(expected, ThreadPriorityPolicy::OFF);
+        }
+    }
+#else
+    (void) previous_policy;
+    switch (level) {
         case 0: {
             SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_IDLE);
         } break;
@@ -71,8 +189,7 @@ inline void update_current_thread_priority(int priority) {
             SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
         } break;
     }
+#endif  // ndef _WIN32
 }
 
-#endif  // def _WIN32
-
 #endif  // NUCLEAR_UTIL_UPDATE_CURRENT_THREAD_PRIORITY_HPP
@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <array>
+#include <atomic>
+#include <catch.hpp>
+#include <cstdint>
+#include <nuclear>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief The number of messages that are emitted
+constexpr int N_MESSAGES = 50;
+/// @brief The number of reactions in each pool that trigger on each message
+constexpr int N_REACTIONS = 4;
+
+/// @brief The number of times each reaction ran
+std::array<std::atomic<int>, 2 * N_REACTIONS> runs{};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The total number of reactions that ran
+std::atomic<int> total{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Message {};
+
+struct OtherPool {
+    static constexpr int thread_count = 2;
+};
+
+class TestReactor : public test_util::TestBase<TestReactor, 5000> {
+public:
+    // The pools go idle between messages so we shutdown once every reaction has run
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        // Each emit submits the tasks for both pools as a single batch
+        for (int i = 0; i < N_REACTIONS; ++i) {
+            on<Trigger<Message>>().then([this, i] { count(i); });
+            on<Trigger<Message>, NUClear::dsl::word::Pool<OtherPool>>().then([this, i] { count(N_REACTIONS + i); });
+        }
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < N_MESSAGES; ++i) {
+                emit(std::make_unique<Message>());
+            }
+        });
+    }
+
+    void count(const int& reaction) {
+        ++runs[reaction];
+        if (++total == 2 * N_REACTIONS * N_MESSAGES) {
+            powerplant.shutdown();
+        }
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Testing that every task in a batch from an emit is run", "[api][batch]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 2;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    REQUIRE(total == 2 * N_REACTIONS * N_MESSAGES);
+    for (const auto& r : runs) {
+        REQUIRE(r == N_MESSAGES);
+    }
+
+    // Only the batches from the emits put tasks in the other pool, and each of them locked its queue once
+    const auto other_id = NUClear::dsl::word::Pool<OtherPool>::pool_descriptor.pool_id;
+    bool found          = false;
+    for (const auto& pool : plant.scheduler_statistics().pools) {
+        if (pool.pool_id == other_id) {
+            found = true;
+            REQUIRE(pool.tasks_submitted == uint64_t(N_REACTIONS * N_MESSAGES));
+            REQUIRE(pool.enqueues == uint64_t(N_MESSAGES));
+        }
+    }
+    REQUIRE(found);
+}
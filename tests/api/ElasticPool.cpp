@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <mutex>
+#include <nuclear>
+#include <set>
+#include <thread>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief The number of tasks in the burst
+constexpr int N_TASKS = 20;
+
+/// @brief The threads that ran the burst tasks and how many tasks ran
+std::set<std::thread::id> threads;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+int finished = 0;                   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex mutex;                   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The number of threads the pool had when the burst finished and after it had been idle for a while
+uint64_t busy_threads = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+uint64_t idle_threads = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct ElasticPool {
+    static constexpr int thread_count              = 1;
+    static constexpr int max_thread_count          = 4;
+    static constexpr int grow_queue_depth          = 2;
+    static constexpr int idle_timeout_milliseconds = 20;
+};
+
+/// @brief The watcher has its own pool so that it doesn't keep the elastic pool busy while it waits
+struct WatcherPool {
+    static constexpr int thread_count = 1;
+};
+
+struct Work {};
+struct BurstDone {};
+
+/// @brief Gets how many threads the elastic pool has right now
+uint64_t elastic_threads(const NUClear::PowerPlant& plant) {
+    const auto pool_id = NUClear::dsl::word::Pool<ElasticPool>::pool_descriptor.pool_id;
+    for (const auto& pool : plant.scheduler_statistics().pools) {
+        if (pool.pool_id == pool_id) {
+            return pool.threads;
+        }
+    }
+    return 0;
+}
+
+class TestReactor : public test_util::TestBase<TestReactor, 5000> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        // Each task blocks for a while so the queue backs up and the pool has to grow to keep up
+        on<Trigger<Work>, NUClear::dsl::word::Pool<ElasticPool>>().then([this] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            const std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+            if (++finished == N_TASKS) {
+                busy_threads = elastic_threads(powerplant);
+                emit(std::make_unique<BurstDone>());
+            }
+        });
+
+        // Once the burst is over the threads the pool added are idle and should leave after the idle timeout
+        on<Trigger<BurstDone>, NUClear::dsl::word::Pool<WatcherPool>>().then([this] {
+            const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            idle_threads   = elastic_threads(powerplant);
+            while (idle_threads > 1 && std::chrono::steady_clock::now() < end) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                idle_threads = elastic_threads(powerplant);
+            }
+            powerplant.shutdown();
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < N_TASKS; ++i) {
+                emit(std::make_unique<Work>());
+            }
+        });
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Testing that elastic thread pools grow when tasks back up", "[api][elastic]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // Every task ran, and the pool used more than its minimum but no more than its maximum number of threads
+    REQUIRE(finished == N_TASKS);
+    REQUIRE(threads.size() > 1);
+    REQUIRE(threads.size() <= 4);
+
+    // Once it was idle the pool shrank back to its minimum number of threads
+    REQUIRE(busy_threads > 1);
+    REQUIRE(idle_threads == 1);
+}
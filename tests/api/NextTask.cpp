@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <catch.hpp>
+#include <nuclear>
+#include <thread>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief The number of links in the emit chain
+constexpr int N_LINKS = 100;
+
+/// @brief The number of links that ran on a different thread to the one that emitted them
+std::atomic<int> moved{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The last link of the chain that has run
+std::atomic<int> last_link{-1};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Link {
+    Link(int index) : index(index) {}
+    int index;
+    std::thread::id emitter{std::this_thread::get_id()};
+};
+
+struct ChainPool {
+    static constexpr int thread_count = 2;
+};
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    // The default pool is idle while the chain runs so we shutdown once the chain is finished
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        // Each link is emitted to the same pool so it is run next by the thread that emitted it
+        on<Trigger<Link>, NUClear::dsl::word::Pool<ChainPool>>().then([this](const Link& link) {
+            if (link.emitter != std::this_thread::get_id()) {
+                ++moved;
+            }
+            last_link = link.index;
+            if (link.index < N_LINKS) {
+                emit(std::make_unique<Link>(link.index + 1));
+            }
+            else {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Link>(0)); });
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Testing that a chain of emits stays on the thread that emitted it", "[api][next_task]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // Only a link that is queued to give the other thread a chance can move, which is at most one in every few links
+    REQUIRE(last_link == N_LINKS);
+    REQUIRE(moved < N_LINKS / 4);
+}
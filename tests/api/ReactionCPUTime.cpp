@@ -0,0 +1,110 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <chrono>
+#include <nuclear>
+#include <thread>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief How long each reaction takes to run
+constexpr std::chrono::milliseconds RUN_TIME(20);
+
+struct Start {};
+
+using NUClear::message::ReactionStatistics;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unique_ptr<ReactionStatistics> busy_stats;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unique_ptr<ReactionStatistics> sleep_stats;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unique_ptr<ReactionStatistics> full_stats;
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        auto busy = on<Trigger<Start>>().then("Busy", [] {
+            const auto end = std::chrono::steady_clock::now() + RUN_TIME;
+            while (std::chrono::steady_clock::now() < end) {
+            }
+        });
+        auto sleeping = on<Trigger<Start>>().then("Sleeping", [] { std::this_thread::sleep_for(RUN_TIME); });
+        auto full     = on<Trigger<Start>>().then("Full", [] { std::this_thread::sleep_for(RUN_TIME); });
+
+        busy.statistics(NUClear::StatisticsLevel::CPU);
+        sleeping.statistics(NUClear::StatisticsLevel::CPU);
+
+        busy_id     = busy.context.lock()->id;
+        sleeping_id = sleeping.context.lock()->id;
+        full_id     = full.context.lock()->id;
+
+        on<Trigger<ReactionStatistics>>().then([this](const ReactionStatistics& stats) {
+            if (stats.reaction_id == busy_id) {
+                busy_stats = std::make_unique<ReactionStatistics>(stats);
+            }
+            else if (stats.reaction_id == sleeping_id) {
+                sleep_stats = std::make_unique<ReactionStatistics>(stats);
+            }
+            else if (stats.reaction_id == full_id) {
+                full_stats = std::make_unique<ReactionStatistics>(stats);
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Start>()); });
+    }
+
+private:
+    NUClear::id_t busy_id{0};
+    NUClear::id_t sleeping_id{0};
+    NUClear::id_t full_id{0};
+};
+
+}  // namespace
+
+TEST_CASE("Reactions at the CPU statistics level record the cpu time they used", "[api][reactionstatistics][cpu]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    REQUIRE(busy_stats != nullptr);
+    REQUIRE(sleep_stats != nullptr);
+    REQUIRE(full_stats != nullptr);
+
+    // Only the CPU level records cpu time, and a reaction that sleeps uses much less cpu than one that doesn't
+    REQUIRE(busy_stats->cpu_time >= RUN_TIME / 4);
+    REQUIRE(sleep_stats->cpu_time < RUN_TIME / 4);
+    REQUIRE(full_stats->cpu_time == std::chrono::nanoseconds(0));
+    REQUIRE(busy_stats->identifiers->name == "Busy");
+
+#ifdef __linux__
+    // Sleeping gives up the cpu
+    REQUIRE(sleep_stats->voluntary_context_switches >= 1);
+#endif  // __linux__
+}
@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <chrono>
+#include <nuclear>
+#include <thread>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief The number of tasks the work reaction runs
+constexpr int N_TASKS = 10;
+/// @brief How long each task of the work reaction takes
+constexpr std::chrono::milliseconds WORK_TIME(2);
+
+struct Work {
+    Work(int i) : i(i) {}
+    int i;
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+uint64_t count = 0;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+uint64_t exceptions = 0;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::vector<NUClear::message::ReactionTimingSummary::Reaction> summaries;
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        work_id = on<Trigger<Work>>()
+                      .then("Work",
+                            [](const Work& work) {
+                                std::this_thread::sleep_for(WORK_TIME);
+                                if (work.i == 3) {
+                                    throw std::runtime_error("Work failed");
+                                }
+                            })
+                      .context.lock()
+                      ->id;
+
+        on<Trigger<NUClear::message::ReactionTimingSummary>>().then(
+            [this](const NUClear::message::ReactionTimingSummary& summary) {
+                for (const auto& reaction : summary.reactions) {
+                    if (reaction.reaction_id == work_id) {
+                        summaries.push_back(reaction);
+                        count += reaction.count;
+                        exceptions += reaction.exceptions;
+                    }
+                }
+                if (count == N_TASKS) {
+                    emit<Scope::DIRECT>(std::make_unique<NUClear::message::ReactionTimingConfiguration>());
+                    powerplant.shutdown();
+                }
+            });
+
+        on<Startup>().then([this] {
+            emit<Scope::DIRECT>(
+                std::make_unique<NUClear::message::ReactionTimingConfiguration>(std::chrono::milliseconds(10)));
+            for (int i = 0; i < N_TASKS; ++i) {
+                emit(std::make_unique<Work>(i));
+            }
+        });
+    }
+
+private:
+    NUClear::id_t work_id{0};
+};
+
+}  // namespace
+
+TEST_CASE("Reaction timings are summarised periodically", "[api][reactiontimings]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    REQUIRE(count == N_TASKS);
+    REQUIRE(exceptions == 1);
+    REQUIRE_FALSE(summaries.empty());
+    for (const auto& reaction : summaries) {
+        REQUIRE(reaction.identifiers->name == "Work");
+        REQUIRE(reaction.run_time.p50 >= WORK_TIME);
+        REQUIRE(reaction.run_time.p50 <= reaction.run_time.p90);
+        REQUIRE(reaction.run_time.p90 <= reaction.run_time.p99);
+        REQUIRE(reaction.run_time.p99 <= reaction.run_time.max);
+        REQUIRE(reaction.queue_delay.p50 <= reaction.queue_delay.max);
+    }
+    REQUIRE_FALSE(NUClear::threading::ReactionTimings::enabled());
+}
@@ -0,0 +1,108 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief The number of tasks to run before looking at the statistics
+constexpr int N_TASKS = 20;
+
+struct Work {};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+int work_done = 0;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+NUClear::message::SchedulerStatistics emitted;
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        on<Trigger<Work>>().then([] { ++work_done; });
+
+        on<Trigger<NUClear::message::SchedulerStatistics>>().then(
+            [this](const NUClear::message::SchedulerStatistics& stats) {
+                if (work_done == N_TASKS) {
+                    emitted = stats;
+                    emit<Scope::DIRECT>(std::make_unique<NUClear::message::SchedulerStatisticsConfiguration>());
+                    powerplant.shutdown();
+                }
+            });
+
+        on<Startup>().then([this] {
+            emit<Scope::DIRECT>(
+                std::make_unique<NUClear::message::SchedulerStatisticsConfiguration>(std::chrono::milliseconds(10)));
+            for (int i = 0; i < N_TASKS; ++i) {
+                emit(std::make_unique<Work>());
+            }
+        });
+    }
+};
+
+/// @brief Finds the statistics for a pool
+const NUClear::message::SchedulerStatistics::Pool* find_pool(const NUClear::message::SchedulerStatistics& stats,
+                                                            const NUClear::id_t& pool_id) {
+    for (const auto& pool : stats.pools) {
+        if (pool.pool_id == pool_id) {
+            return &pool;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+TEST_CASE("Scheduler statistics are emitted periodically and can be pulled", "[api][schedulerstatistics]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    // Before starting the counters are all zero but the pools already exist
+    const auto before = plant.scheduler_statistics();
+    const auto* idle  = find_pool(before, NUClear::util::ThreadPoolDescriptor::DEFAULT_THREAD_POOL_ID);
+    REQUIRE(idle != nullptr);
+    REQUIRE(idle->tasks_run == 0);
+
+    plant.start();
+
+    REQUIRE(work_done == N_TASKS);
+    const auto* pool = find_pool(emitted, NUClear::util::ThreadPoolDescriptor::DEFAULT_THREAD_POOL_ID);
+    REQUIRE(pool != nullptr);
+    REQUIRE(pool->threads == 1);
+    REQUIRE(pool->tasks_submitted >= N_TASKS);
+    REQUIRE(pool->tasks_run >= N_TASKS);
+    REQUIRE(pool->tasks_run <= pool->tasks_submitted);
+    REQUIRE(find_pool(emitted, NUClear::util::ThreadPoolDescriptor::MAIN_THREAD_POOL_ID) != nullptr);
+
+    // Pulling after the run still sees everything that ran
+    const auto after = plant.scheduler_statistics();
+    const auto* done = find_pool(after, NUClear::util::ThreadPoolDescriptor::DEFAULT_THREAD_POOL_ID);
+    REQUIRE(done != nullptr);
+    REQUIRE(done->tasks_run >= pool->tasks_run);
+    REQUIRE(done->queue_depth == 0);
+}
@@ -0,0 +1,131 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <catch.hpp>
+#include <chrono>
+#include <nuclear>
+#include <vector>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief The number of times the ping pong message goes back and forth between the pools
+constexpr int N_ROUNDS = 100;
+
+/// @brief The number of ping and pong reactions that ran
+int pings = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+int pongs = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The number of statistics we got for the ping and pong reactions
+int stats_count = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The time between each pong being emitted and the spinning pool starting it
+std::vector<NUClear::clock::duration> pong_latency;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Ping {
+    Ping(int round) : round(round) {}
+    int round;
+};
+struct Pong {
+    Pong(int round) : round(round) {}
+    int round;
+};
+
+/// @brief The spin is much longer than a round trip so the pong is almost always found by a spinning thread
+struct SpinPool {
+    static constexpr int thread_count      = 1;
+    static constexpr int spin_microseconds = 2000;
+};
+
+using NUClear::message::ReactionStatistics;
+
+class TestReactor : public test_util::TestBase<TestReactor, 5000> {
+public:
+    // The default pool is idle whenever the message is in the other pool so we shutdown once we have every statistic
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        // Each message is picked up by a thread in the other pool which will usually be spinning waiting for it
+        on<Trigger<Ping>>().then("Ping", [this](const Ping& ping) {
+            ++pings;
+            emit(std::make_unique<Pong>(ping.round));
+        });
+        on<Trigger<Pong>, NUClear::dsl::word::Pool<SpinPool>>().then("Pong", [this](const Pong& pong) {
+            ++pongs;
+            if (pong.round < N_ROUNDS) {
+                emit(std::make_unique<Ping>(pong.round + 1));
+            }
+        });
+
+        // The emit to start latency for these reactions is available from their statistics
+        on<Trigger<ReactionStatistics>>().then([this](const ReactionStatistics& stats) {
+            if (stats.identifiers->reactor == reactor_name
+                && (stats.identifiers->name == "Ping" || stats.identifiers->name == "Pong")) {
+                ++stats_count;
+                if (stats.identifiers->name == "Pong") {
+                    pong_latency.push_back(stats.started - stats.emitted);
+                }
+                if (stats_count == 2 * N_ROUNDS) {
+                    powerplant.shutdown();
+                }
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Ping>(1)); });
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Testing that spinning thread pools run every task", "[api][spin]") {
+
+    NUClear::Configuration config;
+    config.thread_count  = 1;
+    config.spin_duration = std::chrono::microseconds(2000);
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    REQUIRE(pings == N_ROUNDS);
+    REQUIRE(pongs == N_ROUNDS);
+    REQUIRE(stats_count == 2 * N_ROUNDS);
+
+    // The threads waiting for the pongs spun before sleeping, and at least some of the pongs arrived while they spun
+    const auto spin_id = NUClear::dsl::word::Pool<SpinPool>::pool_descriptor.pool_id;
+    bool found         = false;
+    for (const auto& pool : plant.scheduler_statistics().pools) {
+        if (pool.pool_id == spin_id) {
+            found = true;
+            INFO("spins " << pool.spins << " spin hits " << pool.spin_hits << " waits " << pool.waits);
+            REQUIRE(pool.spins > 0);
+            REQUIRE(pool.spin_hits > 0);
+            REQUIRE(pool.spin_hits <= pool.spins);
+        }
+    }
+    REQUIRE(found);
+
+    // A spinning thread starts a task as soon as it sees it, so a typical pong starts well within the spin duration
+    REQUIRE(pong_latency.size() == size_t(N_ROUNDS));
+    REQUIRE(*std::min_element(pong_latency.begin(), pong_latency.end()) >= NUClear::clock::duration(0));
+    std::nth_element(pong_latency.begin(), pong_latency.begin() + N_ROUNDS / 2, pong_latency.end());
+    INFO("median pong latency " << pong_latency[N_ROUNDS / 2].count() << "ns");
+    REQUIRE(pong_latency[N_ROUNDS / 2] < std::chrono::microseconds(int(SpinPool::spin_microseconds)));
+}
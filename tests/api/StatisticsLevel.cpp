@@ -0,0 +1,108 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <map>
+#include <nuclear>
+#include <string>
+#include <vector>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief Events that occur during the test
+std::vector<std::string> events;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Round {
+    Round(int n) : n(n) {}
+    int n;
+};
+
+using NUClear::message::ReactionStatistics;
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        auto full   = on<Trigger<Round>>().then("Full", [] {});
+        auto timing = on<Trigger<Round>>().then("Timing", [] {});
+        auto none   = on<Trigger<Round>>().then("None", [] {});
+
+        timing.statistics(NUClear::StatisticsLevel::TIMING);
+        none.statistics(NUClear::StatisticsLevel::NONE);
+
+        names[full.context.lock()->id]   = "Full";
+        names[timing.context.lock()->id] = "Timing";
+        names[none.context.lock()->id]   = "None";
+
+        on<Trigger<ReactionStatistics>>().then([this](const ReactionStatistics& stats) {
+            auto it = names.find(stats.reaction_id);
+            if (it != names.end()) {
+                const bool timed = stats.emitted <= stats.started && stats.started <= stats.finished;
+                events.push_back(it->second + " reaction recorded "
+                                 + (stats.identifiers != nullptr ? "\"" + stats.identifiers->name + "\"" : "no name")
+                                 + (timed ? " with times" : " without times"));
+            }
+        });
+
+        // Runs after the other reactions to start the next round
+        on<Trigger<Round>, Priority::LOW>().then([this](const Round& round) {
+            if (round.n == 1) {
+                events.push_back("Setting the reactor to timing");
+                set_statistics_level(NUClear::StatisticsLevel::TIMING);
+                emit(std::make_unique<Round>(2));
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Round>(1)); });
+    }
+
+private:
+    std::map<NUClear::id_t, std::string> names;
+};
+
+}  // namespace
+
+TEST_CASE("Reactions record as much of their statistics as their level says", "[api][reactionstatistics]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    const std::vector<std::string> expected = {
+        "Full reaction recorded \"Full\" with times",
+        "Timing reaction recorded \"Timing\" with times",
+        "Setting the reactor to timing",
+        "Full reaction recorded \"Full\" with times",
+        "Timing reaction recorded \"Timing\" with times",
+        "None reaction recorded \"None\" with times",
+    };
+
+    // Make an info print the diff in an easy to read way if we fail
+    INFO(test_util::diff_string(expected, events));
+
+    // Check the events fired in order and only those events
+    REQUIRE(events == expected);
+}
@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+#include "test_util/TestBase.hpp"
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+
+namespace {
+
+/// @brief The number of cpus that each pool's thread was allowed to run on, -1 if it didn't run
+int default_cpus = -1;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+int pool_cpus    = -1;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief If each pool's thread was allowed to run on cpu 0
+bool default_on_zero = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+bool pool_on_zero    = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct PinnedPool {
+    static constexpr int thread_count   = 1;
+    static constexpr uint64_t cpu_mask = 0b1;
+};
+
+struct Check {};
+
+void current_cpus(int& count, bool& zero) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+    count = CPU_COUNT(&set);
+    zero  = CPU_ISSET(0, &set);
+}
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        on<Trigger<Check>>().then([] { current_cpus(default_cpus, default_on_zero); });
+        on<Trigger<Check>, NUClear::dsl::word::Pool<PinnedPool>>().then([] { current_cpus(pool_cpus, pool_on_zero); });
+
+        on<Startup>().then([this] { emit(std::make_unique<Check>()); });
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Testing that thread pools are pinned to their cpus", "[api][affinity]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    config.cpu_set.set(0);
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // Both pools were given only cpu 0
+    REQUIRE(default_cpus == 1);
+    REQUIRE(default_on_zero);
+    REQUIRE(pool_cpus == 1);
+    REQUIRE(pool_on_zero);
+}
+
+#endif  // __linux__
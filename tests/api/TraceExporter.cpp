@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "extension/TraceExporter.hpp"
+
+#include <catch.hpp>
+#include <nuclear>
+#include <sstream>
+#include <string>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+struct Cause {};
+struct Effect {};
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        on<Trigger<Cause>>().then("Cause Reaction", [this] { emit(std::make_unique<Effect>()); });
+        on<Trigger<Effect>>().then("Effect Reaction", [] {});
+
+        on<Startup>().then([this] { emit(std::make_unique<Cause>()); });
+    }
+};
+
+/// @brief Counts how many times a string appears in another string
+size_t occurrences(const std::string& haystack, const std::string& needle) {
+    size_t count = 0;
+    for (size_t i = haystack.find(needle); i != std::string::npos; i = haystack.find(needle, i + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST_CASE("The trace exporter writes tasks and their causes as a Chrome trace", "[api][traceexporter]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    auto& exporter = plant.install<NUClear::extension::TraceExporter>();
+    plant.install<TestReactor>();
+    plant.start();
+
+    std::ostringstream out;
+    exporter.write(out);
+    const std::string trace = out.str();
+    INFO(trace);
+
+    REQUIRE(trace.find(R"({"displayTimeUnit":"ns","traceEvents":[)") == 0);
+    REQUIRE(trace.find(R"("thread_name")") != std::string::npos);
+    REQUIRE(occurrences(trace, R"("name":"Cause Reaction")") == 1);
+    REQUIRE(occurrences(trace, R"("name":"Effect Reaction")") == 1);
+
+    // Every flow that starts must also finish, and the cause reaction's task must have started one
+    REQUIRE(occurrences(trace, R"("ph":"s")") >= 1);
+    REQUIRE(occurrences(trace, R"("ph":"s")") == occurrences(trace, R"("ph":"f")"));
+}
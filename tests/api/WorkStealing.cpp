@@ -0,0 +1,162 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <catch.hpp>
+#include <chrono>
+#include <nuclear>
+#include <string>
+#include <thread>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief Events that occur during the test
+std::vector<std::string> events;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// @brief The number of fan out tasks that have finished
+std::atomic<int> finished{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The number of Sync tasks that are currently running
+std::atomic<int> sync_active{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The largest number of Sync tasks that were ever running at the same time
+std::atomic<int> sync_max{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The number of fan out tasks that ran on a different thread to the one that emitted them
+std::atomic<int> stolen{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+constexpr int N_FAN_OUT = 100;
+
+struct Ordered {};
+struct FanOut {
+    FanOut(int depth) : depth(depth) {}
+    int depth;
+    /// @brief The thread that emitted this task, tasks emitted in a pool only go to another thread by being stolen
+    std::thread::id parent{std::this_thread::get_id()};
+};
+
+class OrderReactor : public test_util::TestBase<OrderReactor> {
+public:
+    // Shutdown once every task has run rather than on idle, as with several threads idle can run alongside them
+    OrderReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        // These are all submitted from a pool thread so they go to that thread's queue and must still be ordered when
+        // the other threads steal them. Sync makes them run one at a time so the order they start in is kept
+        on<Trigger<Ordered>, Priority::IDLE, Sync<OrderReactor>>().then([this] { record("Idle"); });
+        on<Trigger<Ordered>, Priority::LOW, Sync<OrderReactor>>().then([this] { record("Low"); });
+        on<Trigger<Ordered>, Priority::NORMAL, Sync<OrderReactor>>().then([this] { record("Normal"); });
+        on<Trigger<Ordered>, Priority::HIGH, Sync<OrderReactor>>().then([this] { record("High"); });
+        on<Trigger<Ordered>, Priority::REALTIME, Sync<OrderReactor>>().then([this] { record("Realtime"); });
+
+        on<Trigger<Step<1>>, Priority::LOW>().then([this] { emit(std::make_unique<Ordered>()); });
+
+        on<Startup>().then([this] { emit(std::make_unique<Step<1>>()); });
+    }
+
+    void record(const std::string& event) {
+        events.push_back(event);
+        if (events.size() == 5) {
+            powerplant.shutdown();
+        }
+    }
+};
+
+class StealReactor : public test_util::TestBase<StealReactor> {
+public:
+    // Shutdown once every task has run rather than on idle, as idle can happen while Sync tasks are still waiting
+    StealReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        // Each fan out task spawns more tasks from within the pool which other threads must steal
+        on<Trigger<FanOut>>().then([this](const FanOut& f) {
+            if (std::this_thread::get_id() != f.parent) {
+                ++stolen;
+            }
+            if (f.depth > 0) {
+                emit(std::make_unique<FanOut>(f.depth - 1));
+                emit(std::make_unique<FanOut>(f.depth - 1));
+            }
+        });
+        on<Trigger<FanOut>, Sync<StealReactor>>().then([this] {
+            const int active = ++sync_active;
+            int current      = sync_max.load();
+            while (active > current && !sync_max.compare_exchange_weak(current, active)) {
+            }
+            --sync_active;
+            if (++finished == N_FAN_OUT * 7) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Trigger<Step<1>>, Priority::LOW>().then([this] {
+            for (int i = 0; i < N_FAN_OUT; ++i) {
+                emit(std::make_unique<FanOut>(2));
+            }
+
+            // Keep this thread busy until another thread has stolen one of its tasks. Its own queue can't be run by
+            // it while it waits here, so the only way the tasks can run is if the other threads steal them
+            const auto give_up = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (stolen == 0 && std::chrono::steady_clock::now() < give_up) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Step<1>>()); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that work stealing thread pools preserve priority order", "[api][workstealing][priority]") {
+
+    NUClear::Configuration config;
+    config.thread_count  = 4;
+    config.work_stealing = true;
+    // The order comes from the scheduler, operating system priorities would let a busy realtime thread starve the rest
+    config.thread_priority_policy = NUClear::util::ThreadPriorityPolicy::OFF;
+    NUClear::PowerPlant plant(config);
+    plant.install<OrderReactor>();
+    plant.start();
+
+    const std::vector<std::string> expected = {"Realtime", "High", "Normal", "Low", "Idle"};
+
+    // Make an info print the diff in an easy to read way if we fail
+    INFO(test_util::diff_string(expected, events));
+
+    // Check the events fired in order and only those events
+    REQUIRE(events == expected);
+}
+
+TEST_CASE("Testing that work stealing thread pools run every task and respect groups", "[api][workstealing][sync]") {
+
+    NUClear::Configuration config;
+    config.thread_count  = 4;
+    config.work_stealing = true;
+    NUClear::PowerPlant plant(config);
+    plant.install<StealReactor>();
+    plant.start();
+
+    // Every fan out task should have run, and never more than one of the Sync tasks at a time
+    REQUIRE(finished == N_FAN_OUT * 7);
+    REQUIRE(sync_max == 1);
+
+    // Every fan out task was emitted from a pool thread into its own queue, so any that ran elsewhere were stolen.
+    // The thread that emitted the first ones waited for this so it can't have run them all itself
+    REQUIRE(stolen > 0);
+}
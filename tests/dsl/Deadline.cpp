@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <chrono>
+#include <nuclear>
+#include <thread>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief Events that occur during the test
+std::vector<std::string> events;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Message {};
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        // Tasks with a deadline run in the order of their deadlines ahead of all the tasks without one
+        on<Trigger<Message>, Priority::REALTIME>().then([] { events.push_back("Realtime"); });
+        on<Trigger<Message>, Deadline<2, std::chrono::seconds>, Priority::HIGH>().then([] {
+            events.push_back("Two Seconds");
+        });
+        on<Trigger<Message>>().then([] { events.push_back("Normal"); });
+        on<Trigger<Message>, Deadline<1, std::chrono::seconds>, Priority::IDLE>().then([] {
+            events.push_back("One Second");
+        });
+        on<Trigger<Message>, Deadline<1>, Priority::LOW>().then([] { events.push_back("One Millisecond"); });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Message>());
+
+            // The pool doesn't start until startup has finished, so waiting here misses the shortest deadline
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        });
+    }
+};
+}  // namespace
+
+
+TEST_CASE("Tests that earliest deadline first pools order tasks by their deadline", "[api][deadline]") {
+
+    NUClear::Configuration config;
+    config.thread_count      = 1;
+    config.scheduling_policy = NUClear::util::SchedulingPolicy::EARLIEST_DEADLINE_FIRST;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    const std::vector<std::string> expected = {
+        "One Millisecond",
+        "One Second",
+        "Two Seconds",
+        "Realtime",
+        "Normal",
+    };
+
+    // Make an info print the diff in an easy to read way if we fail
+    INFO(test_util::diff_string(expected, events));
+
+    // Check the events fired in order and only those events
+    REQUIRE(events == expected);
+
+    // Only the task with the one millisecond deadline started late
+    REQUIRE(plant.missed_deadlines() == 1);
+}
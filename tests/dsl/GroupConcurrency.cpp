@@ -0,0 +1,158 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <catch.hpp>
+#include <nuclear>
+#include <thread>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief The number of threads emitting tasks for the group at the same time
+constexpr int N_EMITTERS = 4;
+/// @brief The number of tasks each emitter makes
+constexpr int N_TASKS = 500;
+/// @brief The number of tasks from the group that can run at once
+constexpr int CONCURRENCY = 2;
+
+/// @brief The number of tasks from the group that are running right now, and the most there ever were
+std::atomic<int> active{0};       // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<int> most_active{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The number of tasks from the group that have finished
+std::atomic<int> finished{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// @brief The same as above for the group whose id is too large for the scheduler's group table
+std::atomic<int> large_active{0};       // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<int> large_most_active{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<int> large_finished{0};     // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Limited {};
+struct Emit {};
+struct Work {};
+struct LargeWork {};
+
+/// @brief A group with an id past the end of the scheduler's group table, which only lets one task run at a time
+struct LargeGroup {
+    template <typename DSL>
+    static NUClear::util::GroupDescriptor group(const NUClear::threading::Reaction& /*reaction*/) {
+        return NUClear::util::GroupDescriptor{2000000, 1};
+    }
+};
+
+/// @brief The emitters each have a thread so they all submit to the group at the same time
+struct EmitterPool {
+    static constexpr int thread_count = N_EMITTERS;
+};
+
+class TestReactor : public test_util::TestBase<TestReactor, 10000> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        on<Trigger<Emit>, NUClear::dsl::word::Pool<EmitterPool>>().then([this] {
+            for (int i = 0; i < N_TASKS; ++i) {
+                emit(std::make_unique<Work>());
+            }
+        });
+
+        // Many threads race to take and give back the group's slots, which are only counted with atomics
+        on<Trigger<Work>, NUClear::dsl::word::Group<Limited, CONCURRENCY>>().then([this] {
+            const int now = ++active;
+            int most      = most_active.load();
+            while (now > most && !most_active.compare_exchange_weak(most, now)) {
+            }
+            std::this_thread::yield();
+            --active;
+
+            if (++finished == N_EMITTERS * N_TASKS) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < N_EMITTERS; ++i) {
+                emit(std::make_unique<Emit>());
+            }
+        });
+    }
+};
+
+class LargeGroupReactor : public test_util::TestBase<LargeGroupReactor, 10000> {
+public:
+    LargeGroupReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        on<Trigger<Emit>, NUClear::dsl::word::Pool<EmitterPool>>().then([this] {
+            for (int i = 0; i < N_TASKS; ++i) {
+                emit(std::make_unique<LargeWork>());
+            }
+        });
+
+        on<Trigger<LargeWork>, LargeGroup>().then([this] {
+            const int now = ++large_active;
+            int most      = large_most_active.load();
+            while (now > most && !large_most_active.compare_exchange_weak(most, now)) {
+            }
+            std::this_thread::yield();
+            --large_active;
+
+            if (++large_finished == N_EMITTERS * N_TASKS) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < N_EMITTERS; ++i) {
+                emit(std::make_unique<Emit>());
+            }
+        });
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Testing that a group never runs more tasks at once than its concurrency", "[api][group][concurrency]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 8;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    REQUIRE(finished == N_EMITTERS * N_TASKS);
+    REQUIRE(active == 0);
+    REQUIRE(most_active >= 1);
+    REQUIRE(most_active <= CONCURRENCY);
+}
+
+TEST_CASE("Testing that a group with an id past the group table is still limited", "[api][group][concurrency]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 8;
+    NUClear::PowerPlant plant(config);
+    plant.install<LargeGroupReactor>();
+    plant.start();
+
+    REQUIRE(large_finished == N_EMITTERS * N_TASKS);
+    REQUIRE(large_active == 0);
+    REQUIRE(large_most_active == 1);
+}
@@ -0,0 +1,139 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <chrono>
+#include <cstdint>
+#include <nuclear>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief The number of messages emitted while the group is blocked, each one makes a task at three priorities
+constexpr int N_JOBS = 10;
+/// @brief The number of tasks that wait on the group
+constexpr uint64_t N_TASKS = 3 * N_JOBS;
+/// @brief The number of threads in the default pool
+constexpr uint64_t N_THREADS = 4;
+
+/// @brief The tasks in the order they ran after the group was released
+std::vector<std::pair<std::string, int>> events;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// @brief The default pool's statistics once every task was waiting on the group, and again a while later
+NUClear::message::SchedulerStatistics::Pool parked_stats;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+NUClear::message::SchedulerStatistics::Pool later_stats;   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Blocked {};
+/// @brief A group that only one task can run in at a time
+using BlockedGroup = NUClear::dsl::word::Group<Blocked>;
+struct Block {};
+struct Job {
+    Job(int i) : i(i) {}
+    int i;
+};
+
+/// @brief The blocker runs in its own pool so the jobs it emits go to the default pool's queue
+struct BlockerPool {
+    static constexpr int thread_count = 1;
+};
+
+/// @brief Gets the statistics for the default pool
+NUClear::message::SchedulerStatistics::Pool default_pool(const NUClear::PowerPlant& plant) {
+    for (const auto& pool : plant.scheduler_statistics().pools) {
+        if (pool.pool_id == NUClear::util::ThreadPoolDescriptor::DEFAULT_THREAD_POOL_ID) {
+            return pool;
+        }
+    }
+    return {};
+}
+
+class TestReactor : public test_util::TestBase<TestReactor, 5000> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        // Holds the only slot in the group while the jobs are emitted, and until every one of them is waiting on it and
+        // the default pool's threads have nothing left to do
+        on<Trigger<Block>, BlockedGroup, NUClear::dsl::word::Pool<BlockerPool>>().then([this] {
+            for (int i = 0; i < N_JOBS; ++i) {
+                emit(std::make_unique<Job>(i));
+            }
+
+            const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            parked_stats   = default_pool(powerplant);
+            while ((parked_stats.parked < N_TASKS || parked_stats.sleeping < N_THREADS)
+                   && std::chrono::steady_clock::now() < end) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                parked_stats = default_pool(powerplant);
+            }
+
+            // Give the pool's threads time to look for work again if they were going to
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            later_stats = default_pool(powerplant);
+        });
+
+        on<Trigger<Job>, BlockedGroup, Priority::LOW>().then([this](const Job& job) { record("Low", job.i); });
+        on<Trigger<Job>, BlockedGroup, Priority::NORMAL>().then([this](const Job& job) { record("Normal", job.i); });
+        on<Trigger<Job>, BlockedGroup, Priority::HIGH>().then([this](const Job& job) { record("High", job.i); });
+
+        on<Startup>().then([this] { emit(std::make_unique<Block>()); });
+    }
+
+    void record(const std::string& priority, const int& i) {
+        events.emplace_back(priority, i);
+        if (events.size() == N_TASKS) {
+            powerplant.shutdown();
+        }
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Tasks waiting on a full group are not rescanned and are released in order", "[api][group][park]") {
+
+    NUClear::Configuration config;
+    config.thread_count = N_THREADS;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // Each task was moved to the group's wait list once, and the idle threads didn't look at them again
+    REQUIRE(parked_stats.parked == N_TASKS);
+    REQUIRE(parked_stats.parks == N_TASKS);
+    REQUIRE(parked_stats.sleeping == N_THREADS);
+    REQUIRE(later_stats.parked == N_TASKS);
+    REQUIRE(later_stats.parks == parked_stats.parks);
+    REQUIRE(later_stats.rescans == parked_stats.rescans);
+
+    // Once the group was released the tasks ran in priority order, and in the order they were emitted within that
+    std::vector<std::pair<std::string, int>> expected;
+    for (const char* priority : {"High", "Normal", "Low"}) {
+        for (int i = 0; i < N_JOBS; ++i) {
+            expected.emplace_back(priority, i);
+        }
+    }
+    REQUIRE(events == expected);
+}
@@ -57,6 +57,38 @@ public:
     }
 };
 
+/// @brief Events that occur in the reactor that holds on to its items
+std::vector<std::string> held_events;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct HeldMessage {
+    HeldMessage(int v) : value(v){};
+    int value;
+};
+
+class HeldReactor : public test_util::TestBase<HeldReactor> {
+public:
+    HeldReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        on<Last<3, Trigger<HeldMessage>>>().then(
+            [](const NUClear::dsl::word::LastItems<std::shared_ptr<const HeldMessage>>& messages) {
+                std::stringstream ss;
+                for (size_t i = 0; i < messages.size(); ++i) {
+                    ss << messages[i]->value << " ";
+                }
+                ss << "(" << messages.front()->value << "-" << messages.back()->value << ")";
+                held_events.push_back(ss.str());
+            });
+
+        // All of these tasks are made before any of them run, so each one must keep its own items even once the
+        // reaction has moved on through several blocks of items
+        on<Startup>().then([this] {
+            for (int i = 0; i < 8; ++i) {
+                emit(std::make_unique<HeldMessage>(i));
+            }
+        });
+    }
+};
+
 }  // namespace
 
 TEST_CASE("Testing the last n feature", "[api][last]") {
@@ -87,3 +119,29 @@ TEST_CASE("Testing the last n feature", "[api][last]") {
     // Check the events fired in order and only those events
     REQUIRE(events == expected);
 }
+
+TEST_CASE("Testing the last n feature when tasks are waiting with their items", "[api][last]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<HeldReactor>();
+    plant.start();
+
+    const std::vector<std::string> expected = {
+        "0 (0-0)",
+        "0 1 (0-1)",
+        "0 1 2 (0-2)",
+        "1 2 3 (1-3)",
+        "2 3 4 (2-4)",
+        "3 4 5 (3-5)",
+        "4 5 6 (4-6)",
+        "5 6 7 (5-7)",
+    };
+
+    // Make an info print the diff in an easy to read way if we fail
+    INFO(test_util::diff_string(expected, held_events));
+
+    // Check the events fired in order and only those events
+    REQUIRE(held_events == expected);
+}
@@ -0,0 +1,91 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief Events that occur during the test
+std::vector<std::string> events;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Message {
+    Message(int v) : value(v){};
+    int value;
+};
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment)) {
+
+        on<Latest<Trigger<Message>>>().then([this](const Message& m) {
+            events.push_back("data " + std::to_string(m.value));
+
+            // These are emitted while this task is running so they need a new task
+            if (m.value == 5) {
+                for (int i = 6; i <= 8; ++i) {
+                    emit(std::make_unique<Message>(i));
+                }
+            }
+            else if (m.value == 8) {
+                emit(std::make_unique<Message>(9));
+            }
+        });
+
+        // This reaction never takes its data, so it is done with it once its task is finished
+        on<Latest<Trigger<Message>>>().then([] { events.push_back("no data"); });
+
+        // All of these are emitted before any task can run so only the newest one is used
+        on<Startup>().then([this] {
+            for (int i = 1; i <= 5; ++i) {
+                emit(std::make_unique<Message>(i));
+            }
+        });
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Testing that the latest data replaces the data of a waiting task", "[api][latest]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    const std::vector<std::string> expected = {
+        "data 5",
+        "no data",
+        "data 8",
+        "data 9",
+        "no data",
+    };
+
+    // Make an info print the diff in an easy to read way if we fail
+    INFO(test_util::diff_string(expected, events));
+
+    // Check the events fired in order and only those events
+    REQUIRE(events == expected);
+}
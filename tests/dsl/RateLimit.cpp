@@ -0,0 +1,87 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+#include "test_util/TestBase.hpp"
+
+namespace {
+
+/// @brief Events that occur during the test
+std::vector<std::string> events;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct Message {
+    Message(int v) : value(v){};
+    int value;
+};
+
+struct Finished {};
+
+class TestReactor : public test_util::TestBase<TestReactor, 2000> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+
+        // Two tokens, with one added every 500ms
+        on<Trigger<Message>, RateLimit<2, std::chrono::seconds>>().then(
+            [](const Message& m) { events.push_back("message " + std::to_string(m.value)); });
+
+        on<Trigger<Finished>>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            // Only the first two of these fit in the bucket
+            for (int i = 0; i < 10; ++i) {
+                emit(std::make_unique<Message>(i));
+            }
+
+            // By the time these arrive one token has been added back to the bucket
+            for (int i = 10; i < 13; ++i) {
+                emit<Scope::DELAY>(std::make_unique<Message>(i), std::chrono::milliseconds(700));
+            }
+
+            emit<Scope::DELAY>(std::make_unique<Finished>(), std::chrono::milliseconds(900));
+        });
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Testing that rate limited reactions only run as often as their rate", "[api][ratelimit]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    const std::vector<std::string> expected = {
+        "message 0",
+        "message 1",
+        "message 10",
+    };
+
+    // Make an info print the diff in an easy to read way if we fail
+    INFO(test_util::diff_string(expected, events));
+
+    // Check the events fired in order and only those events
+    REQUIRE(events == expected);
+}
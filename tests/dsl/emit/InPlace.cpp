@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <catch.hpp>
+#include <nuclear>
+
+#include "../../test_util/TestBase.hpp"
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+/// @brief Events that occur during the test
+std::vector<std::string> events;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct TestMessage {
+    TestMessage(std::string scope, const int& value) : data(std::move(scope) + " " + std::to_string(value)) {}
+    std::string data;
+};
+
+class TestReactor : public test_util::TestBase<TestReactor> {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : TestBase(std::move(environment), false) {
+        emit<Scope::INITIALIZE>(in_place<TestMessage>("Initialise", 1));
+
+        on<Trigger<TestMessage>>().then([this](const TestMessage& v) {
+            events.push_back("Triggered " + v.data);
+            if (events.size() == 5) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Startup>().then([this] {
+            emit(in_place<TestMessage>("Local", 2));
+            emit<Scope::DIRECT>(in_place<TestMessage>("Direct", 3));
+            emit<Scope::DELAY>(in_place<TestMessage>("Delay", 4), std::chrono::milliseconds(10));
+            emit(in_place<TestMessage, NUClear::util::PoolAllocator<TestMessage>>("Pooled", 5));
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing emitting messages constructed in place", "[api][emit][in_place]") {
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // The scopes run at different times so only check that each message arrived once
+    const std::vector<std::string> expected = {
+        "Triggered Delay 4",
+        "Triggered Direct 3",
+        "Triggered Initialise 1",
+        "Triggered Local 2",
+        "Triggered Pooled 5",
+    };
+    std::sort(events.begin(), events.end());
+
+    // Make an info print the diff in an easy to read way if we fail
+    INFO(test_util::diff_string(expected, events));
+
+    // Check the events fired and only those events
+    REQUIRE(events == expected);
+}
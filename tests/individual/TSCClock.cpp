@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+// This define declares that we are using the timestamp counter as the base clock for NUClear
+#define NUCLEAR_CLOCK_TYPE NUClear::tsc_clock
+
+#include <chrono>
+#include <mutex>
+#include <nuclear>
+#include <utility>
+#include <vector>
+
+#include "message/ReactionStatistics.hpp"
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::vector<NUClear::message::ReactionStatistics> stats;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex stats_mutex;
+constexpr int n_stats = 20;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Have a frequently running reaction so that ReactionStatistics will be emitted
+        on<Every<10, std::chrono::milliseconds>>().then([] {});
+
+        on<Trigger<NUClear::message::ReactionStatistics>>().then(
+            [this](const NUClear::message::ReactionStatistics& s) {
+                const std::lock_guard<std::mutex> lock(stats_mutex);
+                stats.push_back(s);
+                if (stats.size() > n_stats) {
+                    powerplant.shutdown();
+                }
+            });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing the tsc clock can be used as the NUClear clock", "[api][tsc_clock]") {
+
+    INFO("Ensure NUClear base_clock is the correct type");
+    STATIC_REQUIRE(std::is_same<NUClear::clock, NUClear::tsc_clock>::value);
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    const auto start = NUClear::clock::now();
+    plant.start();
+    const auto end = NUClear::clock::now();
+
+    // Every task happened while the powerplant was running and its times are in order
+    REQUIRE(stats.size() > n_stats);
+    for (const auto& s : stats) {
+        REQUIRE(start <= s.emitted);
+        REQUIRE(s.emitted <= s.started);
+        REQUIRE(s.started <= s.finished);
+        REQUIRE(s.finished <= end);
+    }
+}
@@ -0,0 +1,229 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <nuclear>
+#include <vector>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+/// @brief If allocations on this thread should be counted
+thread_local bool counting = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// @brief The number of allocations that were counted
+size_t allocations = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// @brief The number of tasks that are run before we start counting so the queues have grown to their final size
+constexpr int WARMUP_TASKS = 100;
+/// @brief The number of tasks to count the allocations of
+constexpr int COUNTED_TASKS = 1000;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+int tasks_run = 0;
+
+/// @brief Records that task i is running and counts allocations if it is in the middle of the chain of tasks
+bool last_task(const int& i) {
+    tasks_run = i;
+    counting  = i >= WARMUP_TASKS && i < WARMUP_TASKS + COUNTED_TASKS;
+    return i == WARMUP_TASKS + COUNTED_TASKS;
+}
+
+class SubmitReactor : public NUClear::Reactor {
+public:
+    SubmitReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+        on<Startup>().then([this] { step(0); });
+    }
+
+    /// @brief Runs a chain of tasks that each submit the next
+    void step(const int& i) {
+        if (last_task(i)) {
+            powerplant.shutdown();
+            return;
+        }
+        powerplant.submit(NUClear::threading::ReactionTask::new_task_id(),
+                          500,
+                          NUClear::util::GroupDescriptor{},
+                          NUClear::util::ThreadPoolDescriptor{},
+                          false,
+                          [this, i] { step(i + 1); });
+    }
+};
+
+struct Ping {
+    Ping(int i) : i(i) {}
+    int i;
+};
+
+class EmitReactor : public NUClear::Reactor {
+public:
+    EmitReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Make the messages up front, as creating them is up to the user rather than the emit
+        for (int i = 0; i <= WARMUP_TASKS + COUNTED_TASKS; ++i) {
+            pings.push_back(std::make_shared<Ping>(i));
+        }
+
+        // A chain of reactions that each emit the message for the next
+        on<Trigger<Ping>>().then([this](const Ping& ping) {
+            if (last_task(ping.i)) {
+                powerplant.shutdown();
+                return;
+            }
+            powerplant.emit_shared<NUClear::dsl::word::emit::Local>(pings[ping.i + 1]);
+        });
+
+        on<Startup>().then([this] { powerplant.emit_shared<NUClear::dsl::word::emit::Local>(pings.front()); });
+    }
+
+private:
+    std::vector<std::shared_ptr<Ping>> pings;
+};
+
+class BatchReactor : public NUClear::Reactor {
+public:
+    BatchReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        for (int i = 0; i <= WARMUP_TASKS + COUNTED_TASKS; ++i) {
+            pings.push_back(std::make_shared<Ping>(i));
+        }
+
+        // Two reactions trigger on each message so every emit submits a batch of tasks
+        on<Trigger<Ping>>().then([this](const Ping& ping) {
+            if (last_task(ping.i)) {
+                powerplant.shutdown();
+                return;
+            }
+            powerplant.emit_shared<NUClear::dsl::word::emit::Local>(pings[ping.i + 1]);
+        });
+        on<Trigger<Ping>>().then([] {});
+
+        on<Startup>().then([this] { powerplant.emit_shared<NUClear::dsl::word::emit::Local>(pings.front()); });
+    }
+
+private:
+    std::vector<std::shared_ptr<Ping>> pings;
+};
+
+class InPlaceReactor : public NUClear::Reactor {
+public:
+    InPlaceReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // A chain of reactions that each make the message for the next in memory recycled from the ones before it
+        on<Trigger<Ping>>().then([this](const Ping& ping) {
+            if (last_task(ping.i)) {
+                powerplant.shutdown();
+                return;
+            }
+            emit(in_place<Ping, NUClear::util::PoolAllocator<Ping>>(ping.i + 1));
+        });
+
+        on<Startup>().then([this] { emit(in_place<Ping, NUClear::util::PoolAllocator<Ping>>(0)); });
+    }
+};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (counting) {
+        ++allocations;
+    }
+    void* ptr = std::malloc(size == 0 ? 1 : size);  // NOLINT(cppcoreguidelines-no-malloc)
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+    std::free(ptr);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+TEST_CASE("Small tasks are submitted and run without allocating once warmed up", "[api][allocations]") {
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<SubmitReactor>();
+    plant.start();
+
+    REQUIRE(tasks_run == WARMUP_TASKS + COUNTED_TASKS);
+    REQUIRE(allocations == 0);
+
+    // Make sure our allocation counting would have seen an allocation if there was one
+    counting       = true;
+    const auto ptr = std::make_unique<int>(0);
+    counting       = false;
+    REQUIRE(allocations == 1);
+}
+
+TEST_CASE("Emitting to a reaction does not allocate when nothing listens for statistics", "[api][allocations]") {
+
+    allocations = 0;
+    tasks_run   = 0;
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<EmitReactor>();
+    plant.start();
+
+    REQUIRE(tasks_run == WARMUP_TASKS + COUNTED_TASKS);
+    REQUIRE(allocations == 0);
+}
+
+TEST_CASE("Emitting to several reactions as a batch does not allocate", "[api][allocations]") {
+
+    allocations = 0;
+    tasks_run   = 0;
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<BatchReactor>();
+    plant.start();
+
+    REQUIRE(tasks_run == WARMUP_TASKS + COUNTED_TASKS);
+    REQUIRE(allocations == 0);
+}
+
+TEST_CASE("Emitting pooled messages made in place does not allocate", "[api][allocations]") {
+
+    allocations = 0;
+    tasks_run   = 0;
+
+    NUClear::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<InPlaceReactor>();
+    plant.start();
+
+    REQUIRE(tasks_run == WARMUP_TASKS + COUNTED_TASKS);
+    REQUIRE(allocations == 0);
+}
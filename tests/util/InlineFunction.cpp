@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "util/InlineFunction.hpp"
+
+#include <array>
+#include <catch.hpp>
+#include <functional>
+#include <memory>
+#include <utility>
+
+SCENARIO("Inline functions store and call callables without needing to copy them", "[util][inline_function]") {
+
+    GIVEN("An empty inline function") {
+        NUClear::util::InlineFunction<int(int)> f;
+
+        THEN("It is false and throws when called") {
+            REQUIRE_FALSE(f);
+            REQUIRE_THROWS_AS(f(1), std::bad_function_call);
+        }
+    }
+
+    GIVEN("An inline function holding a small move only callable") {
+        auto value = std::make_unique<int>(10);
+        NUClear::util::InlineFunction<int(int)> f([v = std::move(value)](int x) { return *v + x; });
+
+        THEN("It can be called") {
+            REQUIRE(f);
+            REQUIRE(f(5) == 15);
+        }
+
+        WHEN("It is moved into another inline function") {
+            NUClear::util::InlineFunction<int(int)> g(std::move(f));
+
+            THEN("The new function has the callable and the old one is empty") {
+                REQUIRE(g(1) == 11);
+                REQUIRE_FALSE(f);  // NOLINT(bugprone-use-after-move,hicpp-invalid-access-moved)
+            }
+        }
+    }
+
+    GIVEN("An inline function holding a callable that is too large to store inline") {
+        std::array<int, 64> values{};
+        values[63] = 7;
+        auto counter = std::make_shared<int>(0);
+        NUClear::util::InlineFunction<int()> f([values, counter] { return values[63]; });
+
+        THEN("It is stored on the heap and can still be called") {
+            REQUIRE(f() == 7);
+            REQUIRE(counter.use_count() == 2);
+        }
+
+        WHEN("It is moved and then reset") {
+            NUClear::util::InlineFunction<int()> g;
+            g = std::move(f);
+            REQUIRE(g() == 7);
+            g = nullptr;
+
+            THEN("The callable is destroyed exactly once") {
+                REQUIRE_FALSE(g);
+                REQUIRE(counter.use_count() == 1);
+            }
+        }
+    }
+
+    GIVEN("An inline function holding a callable with state that is destroyed with it") {
+        auto counter = std::make_shared<int>(0);
+        {
+            NUClear::util::InlineFunction<void()> f([counter] { ++*counter; });
+            f();
+            f();
+            REQUIRE(counter.use_count() == 2);
+        }
+
+        THEN("The state was updated and then released") {
+            REQUIRE(*counter == 2);
+            REQUIRE(counter.use_count() == 1);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "util/LatencyHistogram.hpp"
+
+#include <catch.hpp>
+#include <chrono>
+#include <cstdint>
+
+using NUClear::util::LatencyHistogram;
+
+SCENARIO("Latency histograms bucket durations with a bounded relative error", "[util][latencyhistogram]") {
+
+    GIVEN("Durations across the range of the histogram") {
+        const uint64_t values[] = {0, 1, 15, 16, 17, 100, 1000, 123456, 1000000000, uint64_t(1) << 40};
+
+        THEN("Each duration is in a bucket that contains it and is at most 1/8 wider than its lower bound") {
+            for (const auto& value : values) {
+                const size_t bucket = LatencyHistogram::bucket(value);
+                const uint64_t max  = LatencyHistogram::bucket_max(bucket);
+                const uint64_t min  = bucket == 0 ? 0 : LatencyHistogram::bucket_max(bucket - 1) + 1;
+                INFO("value " << value << " bucket " << bucket << " [" << min << ", " << max << "]");
+                REQUIRE(min <= value);
+                REQUIRE(value <= max);
+                REQUIRE(max - min <= min / 8);
+            }
+        }
+
+        THEN("Durations that are too long go into the last bucket") {
+            REQUIRE(LatencyHistogram::bucket(uint64_t(1) << 50) == LatencyHistogram::BUCKETS - 1);
+            REQUIRE(LatencyHistogram::bucket(UINT64_MAX) == LatencyHistogram::BUCKETS - 1);
+        }
+    }
+
+    GIVEN("A histogram with one hundred durations from 1 to 100 microseconds") {
+        LatencyHistogram histogram;
+        for (int i = 1; i <= 100; ++i) {
+            histogram.record(std::chrono::microseconds(i));
+        }
+        LatencyHistogram::Counts counts{};
+        histogram.drain(counts);
+
+        THEN("The quantiles are no less than and within 1/8 of the true values") {
+            const auto p50 = LatencyHistogram::value_at(counts, 0.5);
+            const auto p99 = LatencyHistogram::value_at(counts, 0.99);
+            const auto max = LatencyHistogram::value_at(counts, 1.0);
+            REQUIRE(p50 >= std::chrono::microseconds(50));
+            REQUIRE(p50 <= std::chrono::microseconds(50) + std::chrono::microseconds(50) / 8);
+            REQUIRE(p99 >= std::chrono::microseconds(99));
+            REQUIRE(max >= std::chrono::microseconds(100));
+            REQUIRE(max <= std::chrono::microseconds(100) + std::chrono::microseconds(100) / 8);
+        }
+
+        WHEN("It is drained again") {
+            LatencyHistogram::Counts again{};
+            histogram.drain(again);
+
+            THEN("It is empty") {
+                REQUIRE(LatencyHistogram::value_at(again, 0.5) == std::chrono::nanoseconds(0));
+            }
+        }
+    }
+}
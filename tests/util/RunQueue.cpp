@@ -0,0 +1,222 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "util/RunQueue.hpp"
+
+#include <catch.hpp>
+#include <chrono>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Item {
+    using Deadline = std::chrono::steady_clock::time_point;
+
+    Item() = default;
+    Item(int id, int priority, Deadline deadline = Deadline::max()) : id(id), priority(priority), deadline(deadline) {}
+    int id{0};
+    int priority{0};
+    Deadline deadline{Deadline::max()};
+};
+
+std::vector<std::pair<int, int>> drain(NUClear::util::RunQueue<Item>& queue) {
+    std::vector<std::pair<int, int>> out;
+    Item item;
+    while (queue.pop(item)) {
+        out.emplace_back(item.priority, item.id);
+    }
+    return out;
+}
+
+}  // namespace
+
+SCENARIO("The run queue orders tasks by priority and then by id", "[util][runqueue]") {
+
+    GIVEN("A run queue with tasks of standard and non standard priorities added out of order") {
+        NUClear::util::RunQueue<Item> queue;
+        queue.push(Item(3, 500));
+        queue.push(Item(1, 500));
+        queue.push(Item(2, 0));
+        queue.push(Item(4, 1000));
+        queue.push(Item(5, 600));
+        queue.push(Item(6, -10));
+        queue.push(Item(7, 2000));
+        queue.push(Item(8, 500));
+
+        THEN("The size and top priority are correct") {
+            REQUIRE(queue.size() == 8);
+            REQUIRE(queue.top_priority() == 2000);
+        }
+
+        WHEN("The queue is drained") {
+            const auto result = drain(queue);
+
+            THEN("Tasks come out in priority order and in id order within a priority") {
+                const std::vector<std::pair<int, int>> expected =
+                    {{2000, 7}, {1000, 4}, {600, 5}, {500, 1}, {500, 3}, {500, 8}, {0, 2}, {-10, 6}};
+                REQUIRE(result == expected);
+                REQUIRE(queue.empty());
+                REQUIRE(queue.top_priority() == std::numeric_limits<int>::min());
+            }
+        }
+
+        WHEN("A task is taken from the middle of the queue") {
+            Item item;
+            const bool found = queue.take_first([](const Item& i) { return i.id == 3; }, item);
+
+            THEN("Only that task is removed") {
+                REQUIRE(found);
+                REQUIRE(item.id == 3);
+                const std::vector<std::pair<int, int>> expected =
+                    {{2000, 7}, {1000, 4}, {600, 5}, {500, 1}, {500, 8}, {0, 2}, {-10, 6}};
+                REQUIRE(drain(queue) == expected);
+            }
+        }
+
+        WHEN("No task matches the predicate") {
+            Item item;
+            const bool found = queue.take_first([](const Item&) { return false; }, item);
+
+            THEN("Nothing is removed") {
+                REQUIRE_FALSE(found);
+                REQUIRE(queue.size() == 8);
+            }
+        }
+    }
+
+    GIVEN("A run queue with several tasks of each non standard priority added out of order") {
+        NUClear::util::RunQueue<Item> queue;
+        queue.push(Item(9, 600));
+        queue.push(Item(2, -10));
+        queue.push(Item(5, 600));
+        queue.push(Item(7, 2000));
+        queue.push(Item(1, 500));
+        queue.push(Item(3, 2000));
+        queue.push(Item(8, -10));
+        queue.push(Item(4, 600));
+        queue.push(Item(6, 100));
+
+        THEN("The top priority is the highest non standard priority") {
+            REQUIRE(queue.top_priority() == 2000);
+        }
+
+        WHEN("The queue is drained") {
+            const auto result = drain(queue);
+
+            THEN("Tasks come out in priority order and in id order within each non standard priority") {
+                const std::vector<std::pair<int, int>> expected =
+                    {{2000, 3}, {2000, 7}, {600, 4}, {600, 5}, {600, 9}, {500, 1}, {100, 6}, {-10, 2}, {-10, 8}};
+                REQUIRE(result == expected);
+            }
+        }
+
+        WHEN("A task that is not the first of the non standard priorities is taken") {
+            Item item;
+            const bool found = queue.take_first([](const Item& i) { return i.priority == 600; }, item);
+
+            THEN("The first task of that priority is removed and the rest stay in order") {
+                REQUIRE(found);
+                REQUIRE(item.id == 4);
+                const std::vector<std::pair<int, int>> expected =
+                    {{2000, 3}, {2000, 7}, {600, 5}, {600, 9}, {500, 1}, {100, 6}, {-10, 2}, {-10, 8}};
+                REQUIRE(drain(queue) == expected);
+            }
+        }
+    }
+
+    GIVEN("More tasks of one priority than the initial capacity of a bucket") {
+        NUClear::util::RunQueue<Item> queue;
+        for (int i = 0; i < 100; ++i) {
+            queue.push(Item(i, 250));
+            // Take one every few to move the head of the ring buffer around as it grows
+            if (i % 3 == 0) {
+                Item item;
+                queue.pop(item);
+            }
+        }
+
+        WHEN("The queue is drained") {
+            const auto result = drain(queue);
+
+            THEN("The remaining tasks are still in first in first out order") {
+                REQUIRE(result.size() == 66);
+                for (size_t i = 1; i < result.size(); ++i) {
+                    REQUIRE(result[i - 1].second < result[i].second);
+                }
+                REQUIRE(result.back().second == 99);
+            }
+        }
+    }
+
+    GIVEN("A run queue ordered by deadline with tasks that do and don't have a deadline") {
+        const auto now = std::chrono::steady_clock::now();
+        NUClear::util::RunQueue<Item> queue(true);
+        queue.push(Item(1, 1000));
+        queue.push(Item(2, 0, now + std::chrono::milliseconds(20)));
+        queue.push(Item(3, 500));
+        queue.push(Item(4, 1000, now + std::chrono::milliseconds(10)));
+        queue.push(Item(5, 250, now + std::chrono::milliseconds(10)));
+
+        THEN("Tasks with a deadline are ahead of every priority") {
+            REQUIRE(queue.top_priority() == std::numeric_limits<int>::max());
+        }
+
+        WHEN("The queue is drained") {
+            const auto result = drain(queue);
+
+            THEN("Tasks come out in deadline order, then in priority order for tasks without a deadline") {
+                const std::vector<std::pair<int, int>> expected = {{1000, 4}, {250, 5}, {0, 2}, {1000, 1}, {500, 3}};
+                REQUIRE(result == expected);
+            }
+        }
+    }
+
+    GIVEN("Many tasks whose deadlines arrive out of order") {
+        const auto now = std::chrono::steady_clock::now();
+        NUClear::util::RunQueue<Item> queue(true);
+        // 37 is coprime with 100 so this visits every deadline once in a scrambled order
+        for (int i = 0; i < 100; ++i) {
+            queue.push(Item(i, 500, now + std::chrono::milliseconds((i * 37) % 100)));
+        }
+
+        WHEN("A task is taken from the middle of the deadlines") {
+            Item item;
+            const bool found = queue.take_first([](const Item& i) { return i.id == 50; }, item);
+
+            THEN("Only that task is removed and the rest still come out in deadline order") {
+                REQUIRE(found);
+                REQUIRE(item.id == 50);
+                REQUIRE(queue.size() == 99);
+                std::vector<Item::Deadline> deadlines;
+                while (queue.pop(item)) {
+                    deadlines.push_back(item.deadline);
+                }
+                REQUIRE(deadlines.size() == 99);
+                for (size_t i = 1; i < deadlines.size(); ++i) {
+                    REQUIRE(deadlines[i - 1] < deadlines[i]);
+                }
+            }
+        }
+    }
+}
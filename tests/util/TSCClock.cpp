@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "tsc_clock.hpp"
+
+#include <catch.hpp>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+/// @brief The absolute value of a duration in nanoseconds
+std::chrono::nanoseconds magnitude(const std::chrono::nanoseconds& d) {
+    return d < std::chrono::nanoseconds(0) ? -d : d;
+}
+
+}  // namespace
+
+SCENARIO("The tsc clock keeps time with steady_clock", "[util][tsc_clock]") {
+
+    GIVEN("Readings of the tsc clock and steady_clock") {
+        const auto tsc_start    = NUClear::tsc_clock::now();
+        const auto steady_start = std::chrono::steady_clock::now();
+
+        WHEN("The clock is read many times in a row") {
+            bool monotonic = true;
+            auto previous  = NUClear::tsc_clock::now();
+            for (int i = 0; i < 100000; ++i) {
+                const auto now = NUClear::tsc_clock::now();
+                monotonic      = monotonic && now >= previous;
+                previous       = now;
+            }
+
+            THEN("It never goes backwards") {
+                REQUIRE(monotonic);
+            }
+        }
+
+        WHEN("Some time passes") {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            const auto tsc_end    = NUClear::tsc_clock::now();
+            const auto steady_end = std::chrono::steady_clock::now();
+
+            THEN("Both clocks measure the same elapsed time") {
+                const auto tsc_elapsed    = tsc_end - tsc_start;
+                const auto steady_elapsed = steady_end - steady_start;
+                REQUIRE(magnitude(tsc_elapsed - steady_elapsed) < std::chrono::milliseconds(5));
+            }
+
+            THEN("The clock has the same epoch as steady_clock") {
+                const auto offset = tsc_end.time_since_epoch() - steady_end.time_since_epoch();
+                REQUIRE(magnitude(offset) < std::chrono::milliseconds(5));
+            }
+        }
+    }
+}
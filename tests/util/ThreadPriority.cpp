@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "util/update_current_thread_priority.hpp"
+
+#include <algorithm>
+#include <catch.hpp>
+#include <thread>
+
+#ifdef __linux__
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+
+namespace {
+
+/// @brief Gets the nice value of the current thread
+int current_nice() {
+    return getpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)));
+}
+
+}  // namespace
+
+SCENARIO("Thread priorities are only changed when the policy allows it", "[util][thread_priority]") {
+
+    GIVEN("The realtime policies") {
+        THEN("Task priorities are spread over the bottom of the range of scheduling priorities") {
+            using NUClear::util::ThreadPriorityPolicy;
+            const int rr_min   = sched_get_priority_min(SCHED_RR);
+            const int rr_max   = sched_get_priority_max(SCHED_RR);
+            const int fifo_min = sched_get_priority_min(SCHED_FIFO);
+            const int fifo_max = sched_get_priority_max(SCHED_FIFO);
+            const int rr_top   = std::min(rr_max, rr_min + 1000 / (rr_max - rr_min));
+            const int fifo_top = std::min(fifo_max, fifo_min + 1000 / (fifo_max - fifo_min));
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::ROUND_ROBIN, 0) == rr_min);
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::ROUND_ROBIN, 1000) == rr_top);
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::FIFO, 0) == fifo_min);
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::FIFO, 1000) == fifo_top);
+
+            // The standard priorities in between are each given a different scheduling priority
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::ROUND_ROBIN, 250) > rr_min);
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::ROUND_ROBIN, 500)
+                    > NUClear::util::thread_priority_level(ThreadPriorityPolicy::ROUND_ROBIN, 250));
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::ROUND_ROBIN, 750)
+                    > NUClear::util::thread_priority_level(ThreadPriorityPolicy::ROUND_ROBIN, 500));
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::ROUND_ROBIN, 750) < rr_top);
+        }
+    }
+
+    GIVEN("The nice policy") {
+        THEN("Task priorities map to nice values around zero") {
+            using NUClear::util::ThreadPriorityPolicy;
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::NICE, 1000) == -10);
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::NICE, 500) == 0);
+            REQUIRE(NUClear::util::thread_priority_level(ThreadPriorityPolicy::NICE, 0) == 10);
+        }
+
+        WHEN("A new thread is given a low priority and then the policy is turned off") {
+            int low_nice   = 0;
+            int off_nice   = 0;
+            bool permitted = false;
+
+            // This only affects the new thread, and if it can't be made less nice again the policy is turned off
+            std::thread([&] {
+                NUClear::util::set_thread_priority_policy(NUClear::util::ThreadPriorityPolicy::NICE);
+                update_current_thread_priority(250);
+                low_nice  = current_nice();
+                permitted = NUClear::util::thread_priority_policy() == NUClear::util::ThreadPriorityPolicy::NICE;
+
+                NUClear::util::set_thread_priority_policy(NUClear::util::ThreadPriorityPolicy::OFF);
+                update_current_thread_priority(0);
+                off_nice = current_nice();
+            }).join();
+            NUClear::util::set_thread_priority_policy(NUClear::util::ThreadPriorityPolicy::ROUND_ROBIN);
+
+            THEN("The nice value changed for the low priority but not once the policy was off") {
+                REQUIRE(low_nice == (permitted ? 5 : 0));
+                REQUIRE(off_nice == (permitted ? 5 : 0));
+            }
+        }
+    }
+}
+
+#endif  // __linux__
@@ -0,0 +1,145 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "util/TypeList.hpp"
+
+#include <atomic>
+#include <catch.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct BasicList {};
+struct ConcurrentList {};
+struct ReleaseList {};
+
+}  // namespace
+
+SCENARIO("The type list is copy on write", "[util][typelist]") {
+
+    using List = NUClear::util::TypeList<BasicList, BasicList, int>;
+
+    GIVEN("A list with some items in it") {
+        List::add(1);
+        List::add(2);
+        List::add(3);
+        const auto before = List::get();
+
+        WHEN("An item is removed") {
+            const bool removed = List::remove([](const int& v) { return v == 2; });
+
+            THEN("The new version of the list doesn't have the item") {
+                REQUIRE(removed);
+                REQUIRE(*List::get() == std::vector<int>({1, 3}));
+            }
+            THEN("The version that was taken before is unchanged") {
+                REQUIRE(*before == std::vector<int>({1, 2, 3}));
+            }
+        }
+
+        WHEN("An item that isn't in the list is removed") {
+            const bool removed = List::remove([](const int& v) { return v == 4; });
+
+            THEN("Nothing changes") {
+                REQUIRE_FALSE(removed);
+                REQUIRE(List::get() == before);
+            }
+        }
+
+        // Empty the list again for the next section
+        while (List::remove([](const int&) { return true; })) {
+        }
+    }
+}
+
+SCENARIO("The type list can be read while it is being changed", "[util][typelist]") {
+
+    using List = NUClear::util::TypeList<ConcurrentList, ConcurrentList, int>;
+
+    GIVEN("A thread that keeps adding to the back of the list and removing from the front") {
+        std::atomic<bool> done{false};
+        std::thread writer([&done] {
+            for (int i = 0; i < 2000; ++i) {
+                List::add(i);
+                if (i >= 10) {
+                    List::remove([](const int&) { return true; });
+                }
+            }
+            done = true;
+        });
+
+        WHEN("Other threads read the list at the same time") {
+            std::atomic<bool> consistent{true};
+            std::vector<std::thread> readers;
+            for (int r = 0; r < 2; ++r) {
+                readers.emplace_back([&done, &consistent] {
+                    while (!done) {
+                        // Every version of the list is a run of increasing numbers with no gaps
+                        const auto list = List::get();
+                        for (size_t i = 1; i < list->size(); ++i) {
+                            if ((*list)[i] != (*list)[i - 1] + 1) {
+                                consistent = false;
+                            }
+                        }
+                        if (list->size() > 11) {
+                            consistent = false;
+                        }
+                    }
+                });
+            }
+            writer.join();
+            for (auto& reader : readers) {
+                reader.join();
+            }
+
+            THEN("Every version they saw was complete") {
+                REQUIRE(consistent);
+                REQUIRE(List::get()->size() == 10);
+                REQUIRE(List::get()->back() == 1999);
+            }
+        }
+    }
+}
+
+SCENARIO("Threads let go of their old versions of a list once an item is removed", "[util][typelist]") {
+
+    using List = NUClear::util::TypeList<ReleaseList, ReleaseList, std::shared_ptr<int>>;
+
+    GIVEN("A thread that has read a list with an item in it") {
+        const auto item = std::make_shared<int>(1);
+        List::add(item);
+        REQUIRE(List::get()->size() == 1);
+
+        WHEN("The item is removed and the thread doesn't read the list again") {
+            List::remove([](const std::shared_ptr<int>&) { return true; });
+
+            THEN("The thread's cached version keeps the item alive until the thread releases its stale caches") {
+                REQUIRE(item.use_count() == 2);
+                NUClear::util::TypeListCache::release_stale();
+                REQUIRE(item.use_count() == 1);
+                REQUIRE(List::get()->empty());
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 NUClear Contributors
+ *
+ * This file is part of the NUClear codebase.
+ * See https://github.com/Fastcode/NUClear for further info.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "util/TypeMap.hpp"
+
+#include <atomic>
+#include <catch.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct BasicMap {};
+struct ConcurrentMap {};
+
+}  // namespace
+
+SCENARIO("The type map stores the last value it was given", "[util][typemap]") {
+
+    using Map = NUClear::util::TypeMap<BasicMap, BasicMap, int>;
+
+    GIVEN("A map that hasn't had anything stored in it") {
+        THEN("It is empty") {
+            REQUIRE(Map::get() == nullptr);
+        }
+
+        WHEN("Some values are stored in it") {
+            Map::set(std::make_shared<int>(1));
+            Map::set(std::make_shared<int>(2));
+
+            THEN("It has the last one") {
+                REQUIRE(*Map::get() == 2);
+            }
+        }
+
+        WHEN("A value that is being held is replaced") {
+            Map::set(std::make_shared<int>(3));
+            const auto before = Map::get();
+            Map::set(std::make_shared<int>(4));
+
+            THEN("The held value is unchanged") {
+                REQUIRE(*before == 3);
+                REQUIRE(*Map::get() == 4);
+            }
+        }
+
+        // Empty the map again for the next section
+        Map::set(nullptr);
+    }
+}
+
+SCENARIO("The type map can be read while it is being written", "[util][typemap]") {
+
+    using Map = NUClear::util::TypeMap<ConcurrentMap, ConcurrentMap, int>;
+
+    GIVEN("A thread that keeps storing bigger numbers") {
+        Map::set(std::make_shared<int>(0));
+        std::atomic<bool> done{false};
+        std::thread writer([&done] {
+            for (int i = 1; i <= 5000; ++i) {
+                Map::set(std::make_shared<int>(i));
+            }
+            done = true;
+        });
+
+        WHEN("Other threads read the map at the same time") {
+            std::atomic<bool> consistent{true};
+            std::vector<std::thread> readers;
+            for (int r = 0; r < 2; ++r) {
+                readers.emplace_back([&done, &consistent] {
+                    int last = 0;
+                    while (!done) {
+                        // Each thread should never see an older value than one it has already seen
+                        const auto value = Map::get();
+                        if (value == nullptr || *value < last) {
+                            consistent = false;
+                        }
+                        else {
+                            last = *value;
+                        }
+                    }
+                });
+            }
+            writer.join();
+            for (auto& reader : readers) {
+                reader.join();
+            }
+
+            THEN("Every value they saw was in order") {
+                REQUIRE(consistent);
+                REQUIRE(*Map::get() == 5000);
+            }
+        }
+    }
+}